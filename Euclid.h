@@ -303,7 +303,7 @@ print_path(const T& vector) noexcept {
 			Euclid.PrintPath(ProofStep4DStdStrVec);
 			Euclid.PrintPath(AxiomCommitLogStdStrVec);
 		} else if (ProofStep4DStdStrVec.size()) {
-			std::cout << "Partial Proof Found." << std::endl;
+			std::cout << "Partial Proof Found. (" << Euclid.RemainingDistance_UInt64 << " tokens from a proof)" << std::endl;
 			Euclid.PrintPath(ProofStep4DStdStrVec);
 			Euclid.PrintPath(AxiomCommitLogStdStrVec);
 		} else {
@@ -350,7 +350,44 @@ print_path(const T& vector) noexcept {
 #include <algorithm>
 #include <iterator>
 #include <type_traits>
-#include <boost/multiprecision/cpp_int.hpp> 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <unordered_set>
+#include <list>
+#include <fstream>
+#include <filesystem>
+#include <random>
+#include <functional>
+#include <span>
+#include <optional>
+#include <set>
+#include <tuple>
+#include <array>
+#include <map>
+#include <chrono>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <boost/multiprecision/cpp_int.hpp>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
 
 namespace Euclid_Prover
 {
@@ -373,7 +410,47 @@ namespace Euclid_Prover
 
 	std::vector<BigInt128_t> PrimeComposite_UInt64Vec{ 2, 3, 5, 7, 11, 13, 17 };
 
-	std::vector<
+	// Bumped whenever the symbol table is replaced (a Resume), which stales every composite encoded against the last one //
+	std::uint64_t SymbolTableGeneration_UInt64{};
+
+	// Taken to add symbols, to replace the symbol table (RestoreSymbolTable), and to count the searches running //
+	std::mutex SymbolTableMutex;
+	std::size_t ActiveSearches_UInt64{};
+
+	/**
+	 * SearchGuard : Counts a search as running for its lifetime. The symbol table is replaced only while no other search
+	 * runs, as every composite a running search holds was encoded against it; a search takes its guard before it encodes,
+	 * and moves it into the worker thread that runs it.
+	*/
+	class SearchGuard
+	{
+	public:
+		SearchGuard()
+		{
+			const std::lock_guard<std::mutex> Lock(SymbolTableMutex);
+			++ActiveSearches_UInt64;
+		}
+
+		SearchGuard(SearchGuard&& InOtherRef) noexcept : bRunningFlag(std::exchange(InOtherRef.bRunningFlag, false))
+		{
+		}
+
+		SearchGuard(const SearchGuard&) = delete;
+		SearchGuard& operator=(const SearchGuard&) = delete;
+
+		~SearchGuard()
+		{
+			if (!bRunningFlag)
+				return;
+			const std::lock_guard<std::mutex> Lock(SymbolTableMutex);
+			--ActiveSearches_UInt64;
+		}
+
+	private:
+		bool bRunningFlag{ true };
+	};
+
+	thread_local std::vector<
 		std::vector<
 		std::vector<
 		std::string>>> TempProofSteps{};
@@ -418,1010 +495,7726 @@ namespace Euclid_Prover
 		return PrimeComposite_UInt64Vec[Index_UInt64];
 	}
 
-	// Generate Internal Route Map //
-	int __Prove__
-	(
-		const
-		std::vector<
-		std::vector<
-		std::string>>&
-		InTheoremStdStrVec,
-
-		const
-		std::vector<
-		std::vector<
-		std::vector<
-		std::string>>>&
-		InAxiomsStdStrVec,
+	/**
+	 * MappedFile : Read-only memory map of a file (RAII).
+	 * usage: MappedFile blob("guid_1f.euclid"); if (blob.valid()) { blob.data(); blob.size(); }
+	*/
+	class MappedFile
+	{
+	public:
+		explicit MappedFile(const std::string& InPathStdStr) noexcept
+		{
+#ifdef _WIN32
+			// Shared for writing and deletion, as POSIX files are: a ProofStore writer updates an index other processes have mapped //
+			FileHandle = CreateFileA(InPathStdStr.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (FileHandle == INVALID_HANDLE_VALUE)
+				return;
+			LARGE_INTEGER FileSize{};
+			if (!GetFileSizeEx(FileHandle, &FileSize) || FileSize.QuadPart == 0)
+				return;
+			MappingHandle = CreateFileMappingA(FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (MappingHandle == nullptr)
+				return;
+			const void* View = MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0);
+			if (View == nullptr)
+				return;
+			Data = static_cast<const unsigned char*>(View);
+			Size = static_cast<std::size_t>(FileSize.QuadPart);
+#else
+			FileDescriptor = open(InPathStdStr.c_str(), O_RDONLY);
+			if (FileDescriptor < 0)
+				return;
+			struct stat FileStat {};
+			if (fstat(FileDescriptor, &FileStat) != 0 || FileStat.st_size == 0)
+				return;
+			void* View = mmap(nullptr, static_cast<std::size_t>(FileStat.st_size), PROT_READ, MAP_SHARED, FileDescriptor, 0);
+			if (View == MAP_FAILED)
+				return;
+			Data = static_cast<const unsigned char*>(View);
+			Size = static_cast<std::size_t>(FileStat.st_size);
+#endif
+		}
 
-		bool&
-		OutProofFound_FlagRef,
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
 
-		bool&
-		OutStatusReadyFlag,
+		~MappedFile() noexcept
+		{
+#ifdef _WIN32
+			if (Data != nullptr)
+				UnmapViewOfFile(Data);
+			if (MappingHandle != nullptr)
+				CloseHandle(MappingHandle);
+			if (FileHandle != INVALID_HANDLE_VALUE)
+				CloseHandle(FileHandle);
+#else
+			if (Data != nullptr)
+				munmap(const_cast<unsigned char*>(Data), Size);
+			if (FileDescriptor >= 0)
+				close(FileDescriptor);
+#endif
+		}
 
-		std::vector<
-		std::vector<
-		std::vector<
-		std::string>>>&
-		OutProofStepStdStrVecRef,
+		bool valid() const noexcept { return Data != nullptr; }
+		const unsigned char* data() const noexcept { return Data; }
+		std::size_t size() const noexcept { return Size; }
 
-		std::vector<
-		std::vector<
-		std::string>>&
-		OutAxiomCommitLogStdStrVecRef
-	)
-	{
-		__stdtracein__("STDThreadProve");
+	private:
+		const unsigned char* Data{};
+		std::size_t Size{};
+#ifdef _WIN32
+		HANDLE FileHandle{ INVALID_HANDLE_VALUE };
+		HANDLE MappingHandle{};
+#else
+		int FileDescriptor{ -1 };
+#endif
+	};
 
-		TempProofSteps = {};
+	/*
+	Checkpoint blob (host byte order, written by __Prove__ on Suspend)
+
+	[CheckpointHeader_Struct]
+	[Section: Symbols]          { symbol, prime } x SectionRecords
+	[Section: Theorem]          { token vector } x SectionRecords
+	[Section: Axioms]           { { token vector } x 2 } x SectionRecords
+	[Section: Tasks]            { BigInt128_t vector } x SectionRecords, best first
+	[Section: FastForwardTasks] { BigInt128_t vector } x SectionRecords
+	[Section: LHSRouteHistory]  { key, BigInt128_t vector } x SectionRecords
+	[Section: RHSRouteHistory]  { key, BigInt128_t vector } x SectionRecords
+	[Section: Counters]         { TotalProofsFound_UInt64, bFastForwardFlag }
+
+	Every record is length-prefixed, so a section can be walked in place
+	from a MappedFile view without first copying the blob into memory.
+	The Tasks section is laid out as a spill run, so a resumed search reads
+	it from the mapping (see ExternalMemoryFrontier::AdoptRun).
+	*/
 
-		bool QED{};
+	enum class CheckpointSection_EnumClass : std::uint32_t
+	{
+		Symbols,
+		Theorem,
+		Axioms,
+		Tasks,
+		FastForwardTasks,
+		LHSRouteHistory,
+		RHSRouteHistory,
+		Counters,
+		_count
+	};
 
-		BigInt128_t GUID_UInt64{};
+	constexpr std::size_t CheckpointSectionCount_UInt64 = static_cast<std::size_t>(CheckpointSection_EnumClass::_count);
 
-		std::vector<BigInt128_t> Theorem_UInt64Vec;
+	struct CheckpointHeader_Struct
+	{
+		char Magic[8]{ 'E', 'U', 'C', 'L', 'I', 'D', 'C', 'P' };
+		std::uint32_t Version_UInt32{ 1 };
+		std::uint32_t SectionCount_UInt32{ static_cast<std::uint32_t>(CheckpointSectionCount_UInt64) };
+		std::uint64_t SectionOffset_UInt64[CheckpointSectionCount_UInt64]{};
+		std::uint64_t SectionRecords_UInt64[CheckpointSectionCount_UInt64]{};
+	};
 
-		auto PopulateTheoremVec =
-			[
-				&
-			]
-		( ) -> void
-		{
-			__stdtracein__("PopulateTheoremVec");
-			for (const std::vector<std::string>& Subnet_StdStrVec : InTheoremStdStrVec)
-			{
-				BigInt128_t PrimeProduct_UInt64Vec{ 1 };
-				for (const std::string& Symbol_StdStr : Subnet_StdStrVec)
-				{
-					__stdlog__({ "'",Symbol_StdStr,"' " });
-					const auto& it = SymbolToPrime_UInt64MultiMap.find(Symbol_StdStr);
-					if (it != SymbolToPrime_UInt64MultiMap.end())
-					{
-						PrimeProduct_UInt64Vec *= it->second;
-						__stdlog__({ "Prime: ", Symbol_StdStr ," <- ",it->second.str(),", PrimeProduct: ", PrimeProduct_UInt64Vec.str() });
-					} else {
-						// This key/value pair is not in the prime number multimap...
-						const BigInt128_t p = Prime();
-						SymbolToPrime_UInt64MultiMap.emplace(Symbol_StdStr, p);
-						PrimeProduct_UInt64Vec *= p;
-						__stdlog__({ "New Prime: ", Symbol_StdStr ," <- ",p.str(),", PrimeProduct: ", PrimeProduct_UInt64Vec.str() });
-					}
-				}
-				__stdlog__({ "" });
-				Theorem_UInt64Vec.emplace_back(PrimeProduct_UInt64Vec);
-			}
-			Theorem_UInt64Vec.emplace_back(0); // guid
-			Theorem_UInt64Vec.emplace_back(0); // last_UInt64 {"_root"}
-			__stdtraceout__("PopulateTheoremVec");
-		};
+	/**
+	 * ProofCheckpoint_Struct : Suspend/Resume hand-off between EuclidProver and __Prove__.
+	 * SuspendRequestFlag is polled once per Tasks_Thread pop; when raised, __Prove__ writes
+	 * its search state to SuspendPathStdStr and returns with SuspendedFlag set.
+	 * A non-empty ResumePathStdStr seeds the search state from a previously written blob.
+	*/
+	struct ProofCheckpoint_Struct
+	{
+		std::atomic<bool> SuspendRequestFlag{};
+		bool SuspendedFlag{};
+		std::string SuspendPathStdStr{};
+		std::string ResumePathStdStr{};
+	};
 
-		std::vector<
-			std::vector<
-			BigInt128_t>> Axioms_UInt64Vec;
+	void CheckpointWriteUInt64(std::ostream& OutStreamRef, const std::uint64_t InValue_UInt64)
+	{
+		OutStreamRef.write(reinterpret_cast<const char*>(&InValue_UInt64), sizeof(InValue_UInt64));
+	}
 
-		auto PopulateAxiomVec =
-			[
-				&
-			]
-		( ) -> void
-		{
-			__stdtracein__("PopulateAxiomVec");
-			for
-				(
-					const
-					std::vector<
-					std::vector<
-					std::string>>&Subnet_StdStrVec :
-					InAxiomsStdStrVec
-				)
-			{
-				std::vector<BigInt128_t> TempInnerAxiom_UInt64Vec{};
-				for
-					(
-						const
-						std::vector<
-						std::string>& Expression_StdStrVec :
-						Subnet_StdStrVec
-					)
-				{
-					BigInt128_t PrimeProduct_UInt64Vec{ 1 };
-					for (const std::string& Symbol_StdStr : Expression_StdStrVec)
-					{
-						__stdlog__({ "'",Symbol_StdStr,"' " });
-						const auto& it = SymbolToPrime_UInt64MultiMap.find(Symbol_StdStr);
-						if (it != SymbolToPrime_UInt64MultiMap.end())
-						{
-							PrimeProduct_UInt64Vec *= it->second;
-							__stdlog__({ "Prime: ", Symbol_StdStr ," <- ",it->second.str(),", PrimeProduct: ", PrimeProduct_UInt64Vec.str() });
-						} else {
-							// This key/value pair is not in the prime number multimap...
-							const BigInt128_t p = Prime();
-							SymbolToPrime_UInt64MultiMap.emplace(Symbol_StdStr, p);
-							PrimeProduct_UInt64Vec *= p;
-							__stdlog__({ "New Prime: ", Symbol_StdStr ," <- ",p.str(),", PrimeProduct: ", PrimeProduct_UInt64Vec.str() });
-						}
-					}
-					__stdlog__({ "" });
-					TempInnerAxiom_UInt64Vec.emplace_back(PrimeProduct_UInt64Vec);
-				}
-				TempInnerAxiom_UInt64Vec.emplace_back(++GUID_UInt64); // guid
-				Axioms_UInt64Vec.emplace_back(TempInnerAxiom_UInt64Vec);
-			}
-			__stdtraceout__("PopulateAxiomVec");
-		};
+	void CheckpointWriteStdStr(std::ostream& OutStreamRef, const std::string& InStdStr)
+	{
+		const std::uint32_t Size_UInt32 = static_cast<std::uint32_t>(InStdStr.size());
+		OutStreamRef.write(reinterpret_cast<const char*>(&Size_UInt32), sizeof(Size_UInt32));
+		OutStreamRef.write(InStdStr.data(), Size_UInt32);
+	}
 
-		std::unordered_map<BigInt128_t, std::unordered_map<BigInt128_t, bool>> CallGraphUInt64Map{};
+	void CheckpointWriteStdStrVec(std::ostream& OutStreamRef, const std::vector<std::string>& InStdStrVec)
+	{
+		CheckpointWriteUInt64(OutStreamRef, InStdStrVec.size());
+		for (const std::string& Symbol_StdStr : InStdStrVec)
+			CheckpointWriteStdStr(OutStreamRef, Symbol_StdStr);
+	}
 
-		/*
-		Theorem
-		[LHS]
-		[RHS]
-		[guid_UInt64]
-		[last_UInt64]
-		[ProofStackUInt64]
+	void CheckpointWriteBigInt(std::ostream& OutStreamRef, const BigInt128_t& InValue)
+	{
+		std::string Bytes_StdStr;
+		boost::multiprecision::export_bits(InValue, std::back_inserter(Bytes_StdStr), 8);
+		CheckpointWriteStdStr(OutStreamRef, Bytes_StdStr);
+	}
 
-		Axiom
-		[LHS]
-		[RHS]
-		[guid_UInt64]
-		*/
+	void CheckpointWriteBigIntVec(std::ostream& OutStreamRef, const std::vector<BigInt128_t>& InUInt64Vec)
+	{
+		CheckpointWriteUInt64(OutStreamRef, InUInt64Vec.size());
+		for (const BigInt128_t& Value : InUInt64Vec)
+			CheckpointWriteBigInt(OutStreamRef, Value);
+	}
 
-		constexpr int LHS = 0;
-		constexpr int RHS = 1;
-		constexpr int guid_UInt64 = 2;
-		constexpr int last_UInt64 = 3;
-		constexpr int ProofStackUInt64 = 4;
+	/**
+	 * CheckpointReader : Bounds-checked cursor over a mapped checkpoint blob.
+	 * A read past the end of the view raises OverrunFlag and yields empty values.
+	*/
+	struct CheckpointReader
+	{
+		const unsigned char* Cursor{};
+		const unsigned char* End{};
+		bool OverrunFlag{};
 
-		auto RebalanceTheoremVec =
-			[
-				&
-			]
-		( ) -> void
+		bool Reserve(const std::size_t InBytes_UInt64) noexcept
 		{
-			__stdtracein__("RebalanceTheoremVec");
-			BigInt128_t& lhs = Theorem_UInt64Vec[LHS];
-			BigInt128_t& rhs = Theorem_UInt64Vec[RHS];
-
-			if (lhs < rhs)
+			if (OverrunFlag || static_cast<std::size_t>(End - Cursor) < InBytes_UInt64)
 			{
-				std::swap(lhs, rhs);
+				OverrunFlag = true;
+				return false;
 			}
-			__stdtraceout__("RebalanceTheoremVec");
-		};
+			return true;
+		}
 
-		auto RebalanceAxiomVec =
-			[
-				&
-			]
-		( ) -> void
+		std::uint64_t ReadUInt64() noexcept
 		{
-			__stdtracein__("RebalanceAxiomVec");
-			for (std::vector<BigInt128_t>& Axiom_i : Axioms_UInt64Vec)
+			std::uint64_t Value_UInt64{};
+			if (Reserve(sizeof(Value_UInt64)))
 			{
-				BigInt128_t& lhs = Axiom_i[LHS];
-				BigInt128_t& rhs = Axiom_i[RHS];
-
-				if (lhs < rhs)
-				{
-					std::swap(lhs, rhs);
-				}
+				std::memcpy(&Value_UInt64, Cursor, sizeof(Value_UInt64));
+				Cursor += sizeof(Value_UInt64);
 			}
-			__stdtraceout__("RebalanceAxiomVec");
-		};
+			return Value_UInt64;
+		}
 
-		PopulateTheoremVec();
-		PopulateAxiomVec();
+		std::string ReadStdStr()
+		{
+			std::uint32_t Size_UInt32{};
+			if (!Reserve(sizeof(Size_UInt32)))
+				return {};
+			std::memcpy(&Size_UInt32, Cursor, sizeof(Size_UInt32));
+			Cursor += sizeof(Size_UInt32);
+			if (!Reserve(Size_UInt32))
+				return {};
+			std::string Value_StdStr(reinterpret_cast<const char*>(Cursor), Size_UInt32);
+			Cursor += Size_UInt32;
+			return Value_StdStr;
+		}
 
-		RebalanceTheoremVec();
-		RebalanceAxiomVec();
+		std::vector<std::string> ReadStdStrVec()
+		{
+			const std::uint64_t Size_UInt64 = ReadUInt64();
+			std::vector<std::string> Value_StdStrVec;
+			for (std::uint64_t i = 0; i < Size_UInt64 && !OverrunFlag; ++i)
+				Value_StdStrVec.emplace_back(ReadStdStr());
+			return Value_StdStrVec;
+		}
 
-		/*
-		std::vector<BigInt128_t> Theorem_UInt64Vec =
+		BigInt128_t ReadBigInt()
 		{
-			1585615607, // "1 + 1 + 1 + 1" (LHS)
-			29, // "4" (RHS)
-			0, // guid_UInt64;
-			0, // last_UInt64 == "_root"
-			--, // ProofStack_UInt64Vec
-		};
+			std::uint32_t Size_UInt32{};
+			BigInt128_t Value{};
+			if (!Reserve(sizeof(Size_UInt32)))
+				return Value;
+			std::memcpy(&Size_UInt32, Cursor, sizeof(Size_UInt32));
+			Cursor += sizeof(Size_UInt32);
+			if (!Reserve(Size_UInt32))
+				return Value;
+			boost::multiprecision::import_bits(Value, Cursor, Cursor + Size_UInt32, 8);
+			Cursor += Size_UInt32;
+			return Value;
+		}
 
-		std::vector<std::vector<BigInt128_t>> Axioms_UInt64Vec =
+		std::vector<BigInt128_t> ReadBigIntVec()
 		{
-			{
-				8303, // "1 + 1" (RHS)
-				31, // "2" (LHS)
-				1, // guid_UInt64
-			},
+			const std::uint64_t Size_UInt64 = ReadUInt64();
+			std::vector<BigInt128_t> Value_UInt64Vec;
+			Value_UInt64Vec.reserve(static_cast<std::size_t>(std::min<std::uint64_t>(Size_UInt64, 1 << 16)));
+			for (std::uint64_t i = 0; i < Size_UInt64 && !OverrunFlag; ++i)
+				Value_UInt64Vec.emplace_back(ReadBigInt());
+			return Value_UInt64Vec;
+		}
+	};
 
-			{
-				22103, // "2 + 2" (RHS)
-				29, // "4" (LHS)
-				2, // guid_UInt64
-			}
-		};
-		*/
+	/**
+	 * OpenCheckpointSection() : Validate the blob header, and position a reader at the first record of a section.
+	 * usage: CheckpointReader reader; std::uint64_t N = OpenCheckpointSection(blob, CheckpointSection_EnumClass::Tasks, reader);
+	*/
+	std::uint64_t OpenCheckpointSection
+	(
+		const MappedFile& InBlobRef,
+		const CheckpointSection_EnumClass InSection,
+		CheckpointReader& OutReaderRef
+	)
+	{
+		OutReaderRef = CheckpointReader{};
+		OutReaderRef.OverrunFlag = true;
+
+		CheckpointHeader_Struct Header{};
+		if (!InBlobRef.valid() || InBlobRef.size() < sizeof(Header))
+			return 0;
+
+		std::memcpy(&Header, InBlobRef.data(), sizeof(Header));
+		const CheckpointHeader_Struct Expected{};
+		if (std::memcmp(Header.Magic, Expected.Magic, sizeof(Header.Magic)) != 0 ||
+			Header.Version_UInt32 != Expected.Version_UInt32 ||
+			Header.SectionCount_UInt32 != Expected.SectionCount_UInt32)
+			return 0;
+
+		const std::size_t Section_UInt64 = static_cast<std::size_t>(InSection);
+		const std::uint64_t Offset_UInt64 = Header.SectionOffset_UInt64[Section_UInt64];
+		if (Offset_UInt64 < sizeof(Header) || Offset_UInt64 > InBlobRef.size())
+			return 0;
+
+		OutReaderRef.Cursor = InBlobRef.data() + Offset_UInt64;
+		OutReaderRef.End = InBlobRef.data() + InBlobRef.size();
+		OutReaderRef.OverrunFlag = false;
+		return Header.SectionRecords_UInt64[Section_UInt64];
+	}
 
-		std::size_t MaxAllowedProofs_UInt64{ 1 };
-		std::size_t TotalProofsFound_UInt64{};
+	/**
+	 * SearchStrategy_EnumClass : The engine __Prove__ searches with.
+	 * BestFirst: Tasks_Thread priority search with route-history fast-forward (supports Suspend/Resume).
+	 * Bidirectional: Breadth-first meet-in-the-middle search (__ProveBidirectional__).
+	 * IDAStar: Iterative-deepening A*, O(depth) memory (__ProveIDAStar__).
+	 * Beam: Fixed-width beam search, O(BeamWidth x depth) memory (__ProveBeam__).
+	 * BreadthFirst: Level-synchronous parallel breadth-first search; shortest proofs (__ProveLevelSynchronous__).
+	 * MinimumCost: A* over per-axiom costs; cheapest proofs (__ProveMinimumCost__).
+	 * EqualitySaturation: Saturate an e-graph of the states until LHS and RHS share an e-class (__ProveEqualitySaturation__).
+	*/
+	enum class SearchStrategy_EnumClass { BestFirst, Bidirectional, IDAStar, Beam, BreadthFirst, MinimumCost, EqualitySaturation };
 
-		using InternalProofStackUInt64Vec = std::vector<BigInt128_t>;
-		std::unordered_map<BigInt128_t, InternalProofStackUInt64Vec> LHSRouteHistoryMap, RHSRouteHistoryMap;
+	/**
+	 * ProofObjectiveKey() : The axiom-set version a strategy files, and looks up, its proofs under in ProofCacheGlobal and the ProofStore.
+	 * BreadthFirst promises the shortest proof and MinimumCost the cheapest (the costs are already part of the version), so each keeps
+	 * its own keys: a proof some other strategy found never answers them. Every other strategy promises just a proof.
+	*/
+	std::uint64_t ProofObjectiveKey(const std::uint64_t InAxiomSetVersion_UInt64, const SearchStrategy_EnumClass InStrategy) noexcept
+	{
+		switch (InStrategy)
+		{
+		case SearchStrategy_EnumClass::BreadthFirst:
+			return InAxiomSetVersion_UInt64 ^ 0x9e3779b97f4a7c15ULL;
+		case SearchStrategy_EnumClass::MinimumCost:
+			return InAxiomSetVersion_UInt64 ^ 0xc2b2ae3d27d4eb4fULL;
+		default:
+			return InAxiomSetVersion_UInt64;
+		}
+	}
 
-		//std::unordered_map<BigInt128_t, bool> TimeoutEntropyQueue{}; // Measure the change in entropy in the Task_Thread //
+	/**
+	 * ProofSearchOptions_Struct : Tunables for __Prove__, shared by every proof an EuclidProver launches.
+	*/
+	struct ProofSearchOptions_Struct
+	{
+		SearchStrategy_EnumClass SearchStrategy{ SearchStrategy_EnumClass::BestFirst };
 
-		bool bTimeoutFlag{};
+		// Tasks_Thread keeps at most this many bytes of nodes in RAM, spilling the remainder to disk (0: unbounded) //
+		std::size_t FrontierMemoryCeiling_UInt64{ std::size_t{ 1 } << 30 };
 
-		std::priority_queue<
-			std::vector<
-			BigInt128_t>> Tasks_Thread, FastForwardTask_Thread;
+		// Sorted run files for spilled Tasks_Thread nodes are written here //
+		std::string SpillDirectoryStdStr{ "." };
 
-		Tasks_Thread.push(Theorem_UInt64Vec);
+		// Beyond this many nodes, the least promising Tasks_Thread nodes are deferred to the standby thread (0: disabled) //
+		std::size_t StandbyThreshold_UInt64{ 1 << 16 };
 
-		// Todo: Implement thread-safe LHSFastForwardMap, RHSFastForwardMap for parrallel access via atomics
-		// Todo: Develop a proofstep generator that can infer solutions and their proofsteps from an axiom's CallGraph
-		// Todo: Add a distance metric or (performance) penalty for employing certain axioms or chains of proofsteps (eg. traversal through mountains vs fording a river)
-		// Todo: Add Remove, SendOffline support for Axioms
-		// Todo: Add Resume, Suspend support for Proofs
-		// Todo: Create a proof-statement hash which can be used as a file handle to a proofstep solution when it posts to a file (stateless)
-		// Todo: Prevent Tasks_Thread (stack) overflows by including a timeout or deferring unprocessed axiom rewrites to a standby thread
+		// Look up, and record, solved theorems in ProofCacheGlobal //
+		bool bProofCacheFlag{ true };
 
-		// *** Core Proof Engine (Loop) *** //
+		// Look up, and record, solved theorems in the on-disk ProofStore kept in this directory ("": disabled) //
+		std::string ProofStoreDirectoryStdStr{};
 
-		bool bFastForwardFlag{};
+		// A goal-set theorem { LHS, RHS_0, RHS_1, ... } stops once this many of its targets are reached (k first hits) //
+		std::size_t MaxProofs_UInt64{ 1 };
 
-		while (!Tasks_Thread.empty() && !QED && !bTimeoutFlag)
-		{
-			//bTimeoutFlag = true;
+		// The closed-set engines (ProveShared, Bidirectional, BreadthFirst, EqualitySaturation) stop after this many distinct states (0: unbounded) //
+		std::size_t StateLimit_UInt64{ 1 << 20 };
 
-			const std::vector<BigInt128_t>
-				Theorem{ !bFastForwardFlag ? Tasks_Thread.top() : FastForwardTask_Thread.top() };
+		// Nodes kept per layer by the Beam engine //
+		std::size_t BeamWidth_UInt64{ 64 };
 
-			!bFastForwardFlag ? Tasks_Thread.pop() : FastForwardTask_Thread.pop();
-
-			bFastForwardFlag = false;
+		// The IDAStar, Beam and BreadthFirst engines, and normal-form proofs, give up on proofs longer than this many steps (EqualitySaturation: iterations) //
+		std::size_t MaxDepth_UInt64{ 1 << 12 };
 
-			// Check rewrite proofs in the task queue //
-			const bool TentativeProofFound_Flag = ( Theorem[LHS] == Theorem[RHS] );
+		// Threads expanding each level of the BreadthFirst engine (0: one per core) //
+		std::size_t SearchWorkers_UInt64{ 0 };
 
-			if (TentativeProofFound_Flag)
-			{
-				/**
-				Alright, we have successfully employed prime number fields
-				to effectively and swiftly reduce the size of our potential solution set.
+		// The MinimumCost engine prunes nodes whose cost plus estimate exceeds this bound, or a proof already found (0: unbounded) //
+		std::uint64_t MaxCost_UInt64{ 0 };
 
-				Now, our next step is to confirm that this narrowed down solution space
-				indeed leads us to a valid routing map...
-				*/
+		// Every engine stops after this many milliseconds, as if its budget were spent (0: unbounded); ProveShared,
+		// ProveKBest and ReachableWithin spend it over the whole call //
+		std::uint64_t TimeBudgetMilliseconds_UInt64{ 0 };
 
-				__stdlog__({ "Tentative Proof Found" });
-				__stdlog__({ "Theorem {", Theorem[LHS].str(), ", ", Theorem[RHS].str(), "} " });
+		// Without a proof, return the trace to the node closest to one (see ClosestNodeTracker) as a partial proof //
+		bool bPartialProofFlag{ true };
 
-				bool ProofFoundFlag{ true };
+		// BestFirst skips redundant and reordered moves (see MovePruningTable). The pruning is decided on composites, and
+		// BestFirst replays the tokens only once it has a proof, so a pruned route may be the only one that replays on the
+		// strings (with a -> b c, c b -> d and a -> d, "a b" reaches "b d" only through the pruned pair, as the shortcut gives
+		// "d b"): clear this flag when a provable theorem's proofs fail to verify //
+		bool bMovePruningFlag{ true };
 
-				TempProofSteps.emplace_back(InTheoremStdStrVec);
+		// BestFirst also moves by the macro-axioms learned from solved proofs (see MacroOperators, EuclidProver::LearnMacros) //
+		bool bMacroOperatorsFlag{ true };
 
-				auto Rewrite = [&]
-					(
-						auto& th,
-						const auto& from,
-						const auto& to
-					) -> bool
-				{
-					__stdtracein__("Rewrite");
-					bool bSuccessFlag{};
+		// BestFirst unions every rewritten state with its parent, and proves a target as soon as it shares the LHS's class (see EGraph) //
+		bool bStateUnionFlag{ true };
 
-					if (th.size() < from.size())
-						return false;
+		// Theorems, and goal-set targets, outside the axioms' difference lattice are rejected before the search (see AxiomLattice) //
+		bool bLatticeCheckFlag{ true };
 
-					std::unordered_map<std::string, std::string>
+		// The search runs on the axioms the theorem's symbols can reach (see SliceAxioms), under compact guids //
+		bool bAxiomSlicingFlag{ true };
 
-						endscope{ {"(", ")"}, { "{", "}" }, { "[", "]" } };
+		// Before searching, normalize both sides under the completed axioms (see CompletedRewriteSystem); search only when completion does not converge //
+		bool bCompletionFlag{ false };
 
-					std::vector<std::string> result{};
+		// Completion gives up after this many equations //
+		std::size_t CompletionBudget_UInt64{ 1 << 12 };
+	};
 
-					std::size_t i{};
+	/**
+	 * ProofResult_Struct : The outcome of one theorem in a ProveBatch (or one proof streamed by ProveKBest).
+	*/
+	struct ProofResult_Struct
+	{
+		bool ProofFoundFlag{};
 
-					const std::size_t I{ from.size() };
+		// Goal-set targets reached (0: the first RHS), in the order they were proven //
+		std::vector<std::size_t> ReachedTargetIndices;
 
-					for (const auto& val : th)
-					{
-						__stdlog__({ "Next val: ", val });
+		std::vector<
+			std::vector<
+			std::vector<
+			std::string>>>
+			ProofStep3DStdStrVec;
 
-						if (!bSuccessFlag && val == from[i])
-						{
-							++i;
+		std::vector<
+			std::vector<
+			std::string>>
+			AxiomCommitLogStdStrVec;
 
-							__stdlog__({ "Match found: ", val, " >> " }, false);
+		// Sum of the axiom costs of the proof (ProveKBest) //
+		std::uint64_t ProofCost_UInt64{};
 
-							const bool bLocalSubnetFoundFlag = ( i == I );
+		// Tokens of the last step of a partial proof (no ProofFoundFlag, but proof steps) left unmatched between LHS and RHS //
+		std::size_t RemainingDistance_UInt64{};
 
-							if (bLocalSubnetFoundFlag)
-							{
-								for (const auto& u2 : to)
-								{
-									__stdlog__({ u2, " " }, false);
-									result.emplace_back(u2);
-								}
+		// Axioms the search left out, unreachable from the theorem's symbols //
+		std::size_t SlicedAxioms_UInt64{};
+	};
 
-								bSuccessFlag = true;
+	/**
+	 * ExternalMemoryFrontier : A priority queue of theorem nodes (drop-in for std::priority_queue<std::vector<BigInt128_t>>)
+	 * with a RAM ceiling. When the in-memory heap exceeds its ceiling, its cold (lowest-priority) half is written,
+	 * best-first, to a sorted run file; top()/pop() merge the heap with the head of every run, so nodes are still
+	 * returned in exact priority order - at disk speed once the hot heap drains.
+	 *
+	 * usage: ExternalMemoryFrontier Tasks_Thread(1 << 30, "."); Tasks_Thread.push(Theorem); Tasks_Thread.top(); Tasks_Thread.pop();
+	*/
+	class ExternalMemoryFrontier
+	{
+	public:
+		using Node = std::vector<BigInt128_t>;
 
-								__stdlog__({ ">> Substitution made" });
+		ExternalMemoryFrontier
+		(
+			const std::size_t InMemoryCeiling_UInt64,
+			const std::string& InSpillDirectoryStdStr
+		) :
+			MemoryCeiling_UInt64{ InMemoryCeiling_UInt64 },
+			SpillDirectoryStdStr{ InSpillDirectoryStdStr }
+		{
+			std::random_device rd;
+			RunPrefixStdStr = "euclid_frontier_" + std::to_string(rd()) + "_" + std::to_string(rd()) + "_";
+		}
 
-								i = 0;
+		ExternalMemoryFrontier(const ExternalMemoryFrontier&) = delete;
+		ExternalMemoryFrontier& operator=(const ExternalMemoryFrontier&) = delete;
 
-								continue;
-							}
-						} else {
-							i = 0; // reset //
+		~ExternalMemoryFrontier()
+		{
+			while (!Runs.empty())
+				CloseRun(Runs.size() - 1);
+		}
 
-							__stdlog__({ "No Match found: ", val });
+		bool empty() const noexcept { return Size_UInt64 == 0; }
+		std::size_t size() const noexcept { return Size_UInt64; }
+		std::size_t spilled() const noexcept { return Size_UInt64 - Hot.size(); }
 
-							result.emplace_back(val);
-						}
-						__stdlog__({ "" });
-					}
+		const Node& top()
+		{
+			const std::size_t Run_UInt64 = BestRun();
+			return Run_UInt64 < Runs.size() ? Runs[Run_UInt64]->Head : Hot.front();
+		}
 
-					th = result;
-					__stdtraceout__("Rewrite");
-					return bSuccessFlag;
-				};
+		void pop()
+		{
+			const std::size_t Run_UInt64 = BestRun();
+			--Size_UInt64;
+			if (Run_UInt64 < Runs.size())
+			{
+				SpillRun& Run = *Runs[Run_UInt64];
+				if (Run.Remaining_UInt64)
+					Run.Advance();
+				else
+					CloseRun(Run_UInt64);
+				return;
+			}
+			std::pop_heap(Hot.begin(), Hot.end());
+			HotBytes_UInt64 -= NodeBytes(Hot.back());
+			Hot.pop_back();
+		}
 
-				/**
-				Q: Write a c++20 algorithm, ProofVerified, which accepts Theorem,
-				InTheoremStdStrVec, and InAxiomsStdStrVec, as parameters and returns a bool type.
+		void push(Node InNode)
+		{
+			HotBytes_UInt64 += NodeBytes(InNode);
+			Hot.emplace_back(std::move(InNode));
+			std::push_heap(Hot.begin(), Hot.end());
+			++Size_UInt64;
 
-				ProofVerified clones InTheoremStdStrVec as OutTheoremStdStrVec, and performs
-				the following operations:
+			if (MemoryCeiling_UInt64 && HotBytes_UInt64 > std::max(MemoryCeiling_UInt64, SpillRetryBytes_UInt64) && Hot.size() > 1)
+				Spill();
+		}
 
-				ProofVerified loops through Theorem, starting at Theorem[ProofStackUInt64],
-				and reads two values from the vector at a time: Theorem[ProofStackUInt64 + i++],
-				Theorem[ProofStackUInt64 + i++] - 1.
+		/**
+		AdoptRun() : Take the InRecords_UInt64 nodes written best-first (CheckpointWriteBigIntVec) at byte InOffset_UInt64 of
+		InPathStdStr as a run, read in place from its mapping; InMapNode, if given, maps each node as it is read.
+		The file is removed once the run drains (or the frontier is destroyed) - or at once, should it fail to map.
+		usage: Tasks_Thread.AdoptRun("guid_1f.euclid", Offset_UInt64, Records_UInt64);
+		*/
+		bool AdoptRun
+		(
+			const std::string& InPathStdStr,
+			const std::uint64_t InRecords_UInt64,
+			const std::uint64_t InOffset_UInt64,
+			std::function<Node(Node)> InMapNode = {}
+		)
+		{
+			if (!OpenRun(InPathStdStr, InRecords_UInt64, InOffset_UInt64, std::move(InMapNode)))
+				return InRecords_UInt64 == 0;
+			Size_UInt64 += InRecords_UInt64;
+			return true;
+		}
 
-				The first value read out,
-				const auto& opcode = Theorem[ProofStackUInt64 + i++], is an opcode
-				whose hexadecimal value may range from 0x00 to 0x03.
+		/**
+		EvictColdest() : Remove, and return, the (up to) InCount_UInt64 lowest-priority nodes of the in-memory heap.
+		*/
+		std::vector<Node> EvictColdest(const std::size_t InCount_UInt64)
+		{
+			std::vector<Node> Cold;
+			const std::size_t Count_UInt64 = std::min(InCount_UInt64, Hot.size());
+			if (Count_UInt64 == 0)
+				return Cold;
+
+			std::sort(Hot.begin(), Hot.end(), [](const Node& a, const Node& b) { return b < a; });
+			Cold.reserve(Count_UInt64);
+			for (std::size_t i = Hot.size() - Count_UInt64; i < Hot.size(); ++i)
+			{
+				HotBytes_UInt64 -= NodeBytes(Hot[i]);
+				Cold.emplace_back(std::move(Hot[i]));
+			}
+			Hot.resize(Hot.size() - Count_UInt64);
+			std::make_heap(Hot.begin(), Hot.end());
+			Size_UInt64 -= Count_UInt64;
+			return Cold;
+		}
 
-				The second value read out, const auto& guid = Theorem[ProofStackUInt64 + i++] - 1,
-				is an index into InAxiomsStdStrVec.
+		static std::size_t NodeBytes(const Node& InNode) noexcept
+		{
+			std::size_t Bytes_UInt64{ sizeof(Node) };
+			for (const BigInt128_t& Value : InNode)
+				Bytes_UInt64 += sizeof(BigInt128_t) + Value.backend().size() * sizeof(boost::multiprecision::limb_type);
+			return Bytes_UInt64;
+		}
 
-				An opcode of 0x00 indicates a "lhsreduce" operation, which replaces all occurrences
-				of InAxiomsStdStrVec[guid][LHS] in OutTheoremStdStrVec[LHS] with InAxiomsStdStrVec[guid][RHS],
-				resizing OutTheoremStdStrVec, as required.
+	private:
+		static constexpr std::size_t MaxRuns_UInt64{ 16 };
 
-				An opcode of 0x01 indicates a "lhsexpand" operation, which replaces all occurrences
-				of InAxiomsStdStrVec[guid][LHS] in OutTheoremStdStrVec[RHS] with InAxiomsStdStrVec[guid][LHS],
-				resizing OutTheoremStdStrVec, as required.
+		struct SpillRun
+		{
+			std::string PathStdStr;
+			std::unique_ptr<MappedFile> Blob;
+			CheckpointReader Reader;
+			std::uint64_t Remaining_UInt64{};
+			Node Head;
 
-				An opcode of 0x02 indicates a "rhsreduce" operation, which replaces all occurrences
-				of InAxiomsStdStrVec[guid][RHS] in OutTheoremStdStrVec[LHS] with InAxiomsStdStrVec[guid][RHS],
-				resizing OutTheoremStdStrVec, as required.
+			// Applied to each node as it is read (empty: none) //
+			std::function<Node(Node)> MapNode;
 
-				An opcode of 0x03 indicates a "rhsexpand" operation, which replaces all occurrences
-				of InAxiomsStdStrVec[guid][RHS] in OutTheoremStdStrVec[RHS] with InAxiomsStdStrVec[guid][LHS],
-				resizing OutTheoremStdStrVec, as required.
+			void Advance()
+			{
+				--Remaining_UInt64;
+				Head = Reader.ReadBigIntVec();
+				if (MapNode)
+					Head = MapNode(std::move(Head));
+			}
+		};
 
-				If ProofVerified is unable to complete the loop, the algorithm returns false.
-				*/
-				auto ProofVerified = [&]
-					(
-						const
-						std::vector<
-						BigInt128_t>&
-						InTheoremUInt64,
-
-						const
-						std::vector<
-						std::vector<
-						std::string>>&
-						InTheoremStdStrVec,
+		const std::size_t MemoryCeiling_UInt64;
+		const std::string SpillDirectoryStdStr;
+		std::string RunPrefixStdStr;
+		std::uint64_t RunCounter_UInt64{};
 
-						const
-						std::vector<
-						std::vector<
-						std::vector<
-						std::string>>>&
-						InAxiomsStdStrVec
-					) -> bool
-				{
-					__stdtracein__("ProofVerified");
+		std::vector<Node> Hot;
+		std::size_t HotBytes_UInt64{};
 
-					bool ReturnStatusFlag{true};
+		// After a failed spill, the next is not tried before the hot heap reaches this many bytes (0: the ceiling) //
+		std::size_t SpillRetryBytes_UInt64{};
 
-					std::vector<
-						std::vector<
-						std::string>>
-						TempTheoremStdStrVec{ InTheoremStdStrVec };
+		// After a failed merge, the next is not tried before there are this many runs (0: MaxRuns_UInt64) //
+		std::size_t MergeRetryRuns_UInt64{};
+		std::size_t Size_UInt64{};
+		std::vector<std::unique_ptr<SpillRun>> Runs;
 
-					//print_path(InTheoremStdStrVec);
+		// Index of the run whose head outranks the hot heap, or Runs.size() when the hot heap wins //
+		std::size_t BestRun() const
+		{
+			std::size_t Best_UInt64 = Runs.size();
+			const Node* BestNode = Hot.empty() ? nullptr : &Hot.front();
+			for (std::size_t i = 0; i < Runs.size(); ++i)
+			{
+				if (BestNode == nullptr || *BestNode < Runs[i]->Head)
+				{
+					Best_UInt64 = i;
+					BestNode = &Runs[i]->Head;
+				}
+			}
+			return Best_UInt64;
+		}
 
-					std::vector<
-						std::string>
-						TempAxiomCommitLogStdStrVecRef;
+		void CloseRun(const std::size_t InRun_UInt64)
+		{
+			const std::string Path_StdStr = Runs[InRun_UInt64]->PathStdStr;
+			Runs.erase(Runs.begin() + InRun_UInt64);
+			std::error_code ec;
+			std::filesystem::remove(Path_StdStr, ec);
+		}
 
-					/**
-					Loop through the Theorem's proofstack, which starts at Theorem[ProofStackUInt64],
-					and read off a pair of values from the vector:
+		bool OpenRun
+		(
+			const std::string& InPathStdStr,
+			const std::uint64_t InRecords_UInt64,
+			const std::uint64_t InOffset_UInt64 = 0,
+			std::function<Node(Node)> InMapNode = {}
+		)
+		{
+			auto Run = std::make_unique<SpillRun>();
+			Run->PathStdStr = InPathStdStr;
+			Run->Blob = std::make_unique<MappedFile>(InPathStdStr);
+			if (!Run->Blob->valid() || InRecords_UInt64 == 0 || InOffset_UInt64 > Run->Blob->size())
+			{
+				std::error_code ec;
+				std::filesystem::remove(InPathStdStr, ec);
+				return false;
+			}
+			Run->Reader.Cursor = Run->Blob->data() + InOffset_UInt64;
+			Run->Reader.End = Run->Blob->data() + Run->Blob->size();
+			Run->Remaining_UInt64 = InRecords_UInt64;
+			Run->MapNode = std::move(InMapNode);
+			Run->Advance();
+			Runs.emplace_back(std::move(Run));
+			return true;
+		}
 
-					1. An opcode whose hexadecimal value
-					ranges from 0x00 to 0x03 (See above for further explanation)
+		std::string NextRunPath()
+		{
+			return ( std::filesystem::path(SpillDirectoryStdStr) / ( RunPrefixStdStr + std::to_string(RunCounter_UInt64++) + ".run" ) ).string();
+		}
 
-					2. An index into InAxiomsStdStrVec, where guid is Axiom_[guid].
-					*/
+		void Spill()
+		{
+			__stdtracein__("ExternalMemoryFrontier::Spill");
 
-					std::size_t i { ProofStackUInt64 };
+			// Hot-first: keep the best half in RAM, write the cold half best-first //
+			std::sort(Hot.begin(), Hot.end(), [](const Node& a, const Node& b) { return b < a; });
+			const std::size_t Keep_UInt64 = ( Hot.size() + 1 ) / 2;
 
-					OutProofStepStdStrVecRef.push_back(TempTheoremStdStrVec);
+			const std::string Path_StdStr = NextRunPath();
+			std::uint64_t Records_UInt64{};
+			bool bWrittenFlag{};
+			{
+				std::ofstream RunFile(Path_StdStr, std::ios::binary | std::ios::trunc);
+				for (std::size_t i = Keep_UInt64; i < Hot.size(); ++i, ++Records_UInt64)
+					CheckpointWriteBigIntVec(RunFile, Hot[i]);
+				RunFile.close();
+				bWrittenFlag = static_cast<bool>(RunFile);
+			}
 
-					while (i < InTheoremUInt64.size())
-					{
-						const std::size_t& opcode = std::size_t{ InTheoremUInt64[i++] };
-						const std::size_t& guid = std::size_t{ InTheoremUInt64[i++] - 1 };
+			// Out of disk: keep every node in RAM rather than lose completeness, and retry only once the heap has doubled //
+			if (!bWrittenFlag || !OpenRun(Path_StdStr, Records_UInt64))
+			{
+				std::error_code ec;
+				std::filesystem::remove(Path_StdStr, ec);
+				std::make_heap(Hot.begin(), Hot.end());
+				SpillRetryBytes_UInt64 = 2 * HotBytes_UInt64;
+				__stdtraceout__("ExternalMemoryFrontier::Spill");
+				return;
+			}
+			SpillRetryBytes_UInt64 = 0;
 
-						switch (opcode)
-						{
-							case 0x00:
-							{ // "lhsreduce" operation //
-								__stdlog__({ "lhs_reduce via Axiom_", std::to_string(guid) });
-								ReturnStatusFlag =
-									Rewrite (TempTheoremStdStrVec[LHS], InAxiomsStdStrVec[guid][LHS], InAxiomsStdStrVec[guid][RHS]);
-								TempAxiomCommitLogStdStrVecRef.emplace_back("lhs_reduce via Axiom_" + std::to_string(guid));
-								break;
-							}
-							case 0x01:
-							{ // "lhsexpand" operation //
-								__stdlog__({ "lhs_expand via Axiom_", std::to_string(guid) });
-								ReturnStatusFlag =
-									Rewrite (TempTheoremStdStrVec[LHS], InAxiomsStdStrVec[guid][RHS], InAxiomsStdStrVec[guid][LHS]);
-								TempAxiomCommitLogStdStrVecRef.emplace_back("lhs_expand via Axiom_" + std::to_string(guid));
-								break;
-							}
-							case 0x02:
-							{ // "rhsreduce" operation //
-								__stdlog__({ "rhs_reduce via Axiom_", std::to_string(guid) });
-								ReturnStatusFlag =
-									Rewrite (TempTheoremStdStrVec[RHS], InAxiomsStdStrVec[guid][LHS], InAxiomsStdStrVec[guid][RHS]);
-								TempAxiomCommitLogStdStrVecRef.emplace_back("rhs_reduce via Axiom_" + std::to_string(guid));
-								break;
-							}
-							case 0x03:
-							{ // "rhsexpand" operation //
-								__stdlog__({ "rhs_expand via Axiom_", std::to_string(guid) });
-								ReturnStatusFlag =
-									Rewrite (TempTheoremStdStrVec[RHS], InAxiomsStdStrVec[guid][RHS], InAxiomsStdStrVec[guid][LHS]);
-								TempAxiomCommitLogStdStrVecRef.emplace_back("rhs_expand via Axiom_" + std::to_string(guid));
-								break;
-							}
-							default:
-							{
-								// Invalid opcode. //
-								TempAxiomCommitLogStdStrVecRef.emplace_back("???? via Axiom_" + std::to_string(guid));
-								break;
-							}
-						} // end switch(opcode)
-						OutProofStepStdStrVecRef.push_back(TempTheoremStdStrVec);
+			Hot.resize(Keep_UInt64);
+			std::make_heap(Hot.begin(), Hot.end());
+			HotBytes_UInt64 = 0;
+			for (const Node& InNode : Hot)
+				HotBytes_UInt64 += NodeBytes(InNode);
 
-						//print_path(TempTheoremStdStrVec);
+			if (Runs.size() > std::max(MaxRuns_UInt64, MergeRetryRuns_UInt64))
+				MergeRuns();
 
-						if (!ReturnStatusFlag) 
-							break;
-					}
-					OutAxiomCommitLogStdStrVecRef.push_back(TempAxiomCommitLogStdStrVecRef);
+			__stdtraceout__("ExternalMemoryFrontier::Spill");
+		}
 
-					//print_path(OutProofStepStdStrVecRef);
+		// k-way merge of every run into one, bounding the number of open mappings.
+		// The source runs are read through copies of their cursors, and closed only once the merged run is on disk and mapped:
+		// should either fail, the partial file is removed and every source run is kept as it was //
+		void MergeRuns()
+		{
+			__stdtracein__("ExternalMemoryFrontier::MergeRuns");
 
-					// If TentativeProofVerified is unable to finish the loop, return false.
-					__stdtraceout__("ProofVerified");
-					return ReturnStatusFlag;
-				};
+			struct Cursor_Struct
+			{
+				CheckpointReader Reader;
+				std::uint64_t Remaining_UInt64{};
+				Node Head;
+			};
 
-				//QED = true;
-				//break;
+			std::vector<Cursor_Struct> Cursors;
+			Cursors.reserve(Runs.size());
+			for (const std::unique_ptr<SpillRun>& Run : Runs)
+				Cursors.push_back({ Run->Reader, Run->Remaining_UInt64, Run->Head });
 
-				if 
-					(
-						ProofVerified
-						(
-							Theorem,
-							InTheoremStdStrVec,
-							InAxiomsStdStrVec
-						)
-					)
+			const std::size_t Sources_UInt64 = Runs.size();
+			const std::string Path_StdStr = NextRunPath();
+			std::uint64_t Records_UInt64{};
+			bool bWrittenFlag{};
+			{
+				std::ofstream RunFile(Path_StdStr, std::ios::binary | std::ios::trunc);
+				std::vector<std::size_t> Live;
+				for (std::size_t i = 0; i < Sources_UInt64; ++i)
+					Live.emplace_back(i);
+				while (!Live.empty() && RunFile)
 				{
-					++TotalProofsFound_UInt64;
-
-					__stdlog__({ "Proof Found" });
-					__stdlog__({ "Theorem {", Theorem[LHS].str(), ", ", Theorem[RHS].str(), "}\n" });
-
-					if (TotalProofsFound_UInt64 >= MaxAllowedProofs_UInt64)
-					{
-						QED = true;
-						break;
-					}
-				} else {
-					// Retain Partial-proof //
-					continue;
+					std::size_t Best_UInt64{};
+					for (std::size_t i = 1; i < Live.size(); ++i)
+						if (Runs[Live[Best_UInt64]]->Head < Runs[Live[i]]->Head)
+							Best_UInt64 = i;
+
+					SpillRun& Run = *Runs[Live[Best_UInt64]];
+					CheckpointWriteBigIntVec(RunFile, Run.Head);
+					++Records_UInt64;
+					if (Run.Remaining_UInt64)
+						Run.Advance();
+					else
+						Live.erase(Live.begin() + static_cast<std::ptrdiff_t>(Best_UInt64));
 				}
+				RunFile.close();
+				bWrittenFlag = Live.empty() && static_cast<bool>(RunFile);
+			}
 
-			} else {
-
-				// Add new rewrites to the task queue //
-				const auto& theoremLHS = Theorem[LHS];
-				const auto& theoremRHS = Theorem[RHS];
-
-				//std::shared_mutex lhsMutex, rhsMutex, tasksMutex, ffMutex;
-
-				for (const auto& Axiom : Axioms_UInt64Vec)
+			if (!bWrittenFlag || !OpenRun(Path_StdStr, Records_UInt64))
+			{
+				std::error_code ec;
+				std::filesystem::remove(Path_StdStr, ec);
+				for (std::size_t i = 0; i < Sources_UInt64; ++i)
 				{
-					const auto& AxiomLHS = Axiom[LHS];
-					const auto& AxiomRHS = Axiom[RHS];
+					Runs[i]->Reader = Cursors[i].Reader;
+					Runs[i]->Remaining_UInt64 = Cursors[i].Remaining_UInt64;
+					Runs[i]->Head = std::move(Cursors[i].Head);
+				}
+				MergeRetryRuns_UInt64 = 2 * Sources_UInt64;
+				__stdtraceout__("ExternalMemoryFrontier::MergeRuns");
+				return;
+			}
 
-					//const bool SubnetFound = CallGraphUInt64Map[Theorem[last_UInt64]][Axiom[guid_UInt64]];
-					//std::cout << SubnetFound << std::endl;
+			for (std::size_t i = Sources_UInt64; i-- > 0; )
+				CloseRun(i);
+			MergeRetryRuns_UInt64 = 0;
 
-					if (theoremLHS % AxiomLHS == 0 )
-					{
-						std::vector<BigInt128_t> Theorem_0000{ Theorem };
-						Theorem_0000[LHS] = Theorem_0000[LHS] / AxiomLHS * AxiomRHS;
+			__stdtraceout__("ExternalMemoryFrontier::MergeRuns");
+		}
+	};
 
-						Theorem_0000[last_UInt64] = Axiom[guid_UInt64];
-						Theorem_0000.emplace_back(0x00); // Push opcode 0x00 onto the proofstack because we performed a _lhs _reduce operation) //
-						Theorem_0000.emplace_back(Axiom[guid_UInt64]); // Push the Axiom ID onto the proofstack //
-						__stdlog__({ "lhs_reduce in Module_0000 via Axiom_", Axiom[guid_UInt64].str(), " {", Theorem_0000[LHS].str(), ", ", Theorem_0000[RHS].str(), "}" });
+	/**
+	 * Rewrite() : Substitute the first occurrence of the token subnet, from, in th with to.
+	*/
+	bool Rewrite
+	(
+		std::vector<
+		std::string>&
+		th,
 
-						// Commit for later fast-forward //
-						if (LHSRouteHistoryMap.find(Theorem_0000[LHS]) == LHSRouteHistoryMap.end())
-							LHSRouteHistoryMap.emplace(Theorem_0000[LHS], Theorem_0000);
-
-						// Attempt fast-forward //
-						if (RHSRouteHistoryMap.find(Theorem_0000[LHS]) != RHSRouteHistoryMap.end()) {
-							//std::cout << "Proof found in Module_0000 via Fast-Forward (FF)" << " {" << Theorem_0000[LHS].str() << ", " << Theorem_0000[LHS].str() << "}" << std::endl;
-							__stdlog__({ "Proof found in Module_0000 via Fast-Forward (FF)" });
-							auto opcode = RHSRouteHistoryMap[Theorem_0000[LHS]].begin() + ProofStackUInt64;
-							const auto OPCODE = RHSRouteHistoryMap[Theorem_0000[LHS]].end();
-							for (; opcode != OPCODE; ++opcode)
-								Theorem_0000.emplace_back(*opcode);
-							Theorem_0000[RHS] = Theorem_0000[LHS];
+		const
+		std::vector<
+		std::string>&
+		from,
 
-							// Is the FF queue still empty? //
-							if (FastForwardTask_Thread.empty()) {
-								bFastForwardFlag = true;
-								FastForwardTask_Thread.push(Theorem_0000);
-								break;
-							}
-						}
-						Tasks_Thread.push(Theorem_0000);
-					}
+		const
+		std::vector<
+		std::string>&
+		to
+	)
+	{
+		__stdtracein__("Rewrite");
 
-					if (theoremLHS % AxiomRHS == 0)
-					{
-						std::vector<BigInt128_t> Theorem_0001{ Theorem };
-						Theorem_0001[LHS] = Theorem_0001[LHS] / AxiomRHS * AxiomLHS;
-						Theorem_0001[last_UInt64] = Axiom[guid_UInt64];
-						Theorem_0001.emplace_back(0x01); // Push opcode 0x01 onto the proofstack because we performed a _lhs _expand operation) //
-						Theorem_0001.emplace_back(Axiom[guid_UInt64]); // Push the Axiom ID onto the proofstack //
-						__stdlog__({ "lhs_expand in Module_0001 via Axiom_", Axiom[guid_UInt64].str(), " {", Theorem_0001[LHS].str(), ", ", Theorem_0001[RHS].str(), "}" });
+		// A partial match must not consume the tokens it spanned, so search for the whole subnet first //
+		const auto it = from.empty() ? th.end() : std::search(th.begin(), th.end(), from.begin(), from.end());
+		const bool bSuccessFlag = ( it != th.end() );
 
-						// Commit for later fast-forward //
-						if (LHSRouteHistoryMap.find(Theorem_0001[LHS]) == LHSRouteHistoryMap.end())
-							LHSRouteHistoryMap.emplace(Theorem_0001[LHS], Theorem_0001);
-
-						// Attempt fast-forward //
-						if (RHSRouteHistoryMap.find(Theorem_0001[LHS]) != RHSRouteHistoryMap.end()) {
-							//std::cout << "Proof found in Module_0001 via Fast-Forward (FF)" << " {" << Theorem_0001[LHS].str() << ", " << Theorem_0001[LHS].str() << "}" << std::endl;
-							__stdlog__({ "Proof found in Module_0001 via Fast-Forward (FF)" });
-							auto opcode = RHSRouteHistoryMap[Theorem_0001[LHS]].begin() + ProofStackUInt64;
-							const auto OPCODE = RHSRouteHistoryMap[Theorem_0001[LHS]].end();
-							for (; opcode != OPCODE; ++opcode)
-								Theorem_0001.emplace_back(*opcode);
-							Theorem_0001[RHS] = Theorem_0001[LHS];
+		if (bSuccessFlag)
+		{
+			__stdlog__({ ">> Substitution made" });
+			const auto Offset = it - th.begin();
+			th.erase(it, it + static_cast<std::ptrdiff_t>(from.size()));
+			th.insert(th.begin() + Offset, to.begin(), to.end());
+		}
 
-							// Is the FF queue still empty? //
-							if (FastForwardTask_Thread.empty()) {
-								bFastForwardFlag = true;
-								FastForwardTask_Thread.push(Theorem_0001);
-								break;
-							}
-						}
-						Tasks_Thread.push(Theorem_0001);
-					}
+		__stdtraceout__("Rewrite");
+		return bSuccessFlag;
+	}
 
-					if (theoremRHS % AxiomLHS == 0)
-					{
-						std::vector<BigInt128_t> Theorem_0002{ Theorem };
-						Theorem_0002[RHS] = Theorem_0002[RHS] / AxiomLHS * AxiomRHS;
-						Theorem_0002[last_UInt64] = Axiom[guid_UInt64];
-						Theorem_0002.emplace_back(0x02); // Push opcode 0x02 onto the proofstack because we performed a _rhs _reduce operation) //
-						Theorem_0002.emplace_back(Axiom[guid_UInt64]); // Push the Axiom ID onto the proofstack //
-						__stdlog__({ "rhs_reduce in Module_0002 via Axiom_", Axiom[guid_UInt64].str(), " {" , Theorem_0002[LHS].str(), ", ", Theorem_0002[RHS].str(), "}" });
+	/**
+	 * DirectedAxiom() : Whether a library entry is a directed rule - a lemma, { From, To, { "==>" } } (see EuclidProver::Lemmas) -
+	 * which only ever rewrites From into To: by the reduce opcodes, never the expand ones.
+	*/
+	bool DirectedAxiom(const std::vector<std::vector<std::string>>& InAxiomStdStrVec)
+	{
+		return InAxiomStdStrVec.size() > 2 && InAxiomStdStrVec[2].size() == 1 && InAxiomStdStrVec[2][0] == "==>";
+	}
 
-						// Commit for later fast-forward //
-						if (RHSRouteHistoryMap.find(Theorem_0002[RHS]) == RHSRouteHistoryMap.end())
-							RHSRouteHistoryMap.emplace(Theorem_0002[RHS], Theorem_0002);
-
-						// Attempt fast-forward //
-						if (LHSRouteHistoryMap.find(Theorem_0002[RHS]) != LHSRouteHistoryMap.end()) {
-							//std::cout << "Proof found in Module_0002 via Fast-Forward (FF)" << " {" << Theorem_0002[RHS].str() << ", " << Theorem_0002[RHS].str() << "}" << std::endl;
-							__stdlog__({ "Proof found in Module_0002 via Fast-Forward (FF)" });
-							auto opcode = LHSRouteHistoryMap[Theorem_0002[RHS]].begin() + ProofStackUInt64;
-							const auto OPCODE = LHSRouteHistoryMap[Theorem_0002[RHS]].end();
-							for (; opcode != OPCODE; ++opcode)
-								Theorem_0002.emplace_back(*opcode);
-							Theorem_0002[LHS] = Theorem_0002[RHS];
+	/**
+	 * DirectionAllowed() : Whether an encoded axiom runs by InOpcode_UInt64. EncodeAxioms marks a directed rule with the
+	 * parity of the opcodes that run it (a fourth element: 0, reduce; 1, expand, once rebalancing has swapped its sides).
+	 * A removed axiom, encoded as its guid alone, runs by none; so check this before reading the axiom's sides.
+	*/
+	bool DirectionAllowed(const std::vector<BigInt128_t>& InAxiomRef, const std::size_t InOpcode_UInt64)
+	{
+		return InAxiomRef.size() == 3 || ( InAxiomRef.size() > 3 && InAxiomRef[3] == ( InOpcode_UInt64 & 0x01 ) );
+	}
 
-							// Is the FF queue still empty? //
-							if (FastForwardTask_Thread.empty()) {
-								bFastForwardFlag = true;
-								FastForwardTask_Thread.push(Theorem_0002);
-								break;
-							}
-						}
-						Tasks_Thread.push(Theorem_0002);
-					}
+	/**
+	Q: Write a c++20 algorithm, ProofVerified, which accepts Theorem,
+	InTheoremStdStrVec, and InAxiomsStdStrVec, as parameters and returns a bool type.
 
-					if (theoremRHS % AxiomRHS == 0)
-					{
-						std::vector<BigInt128_t> Theorem_0003{ Theorem };
-						Theorem_0003[RHS] = Theorem_0003[RHS] / AxiomRHS * AxiomLHS;
-						Theorem_0003[last_UInt64] = Axiom[guid_UInt64];
-						Theorem_0003.emplace_back(0x03); // Push opcode 0x03 onto the proofstack because we performed a _rhs _expand operation) //
-						Theorem_0003.emplace_back(Axiom[guid_UInt64]); // Push the Axiom ID onto the proofstack //
-						__stdlog__({ "rhs_expand in Module_0003 via Axiom_", Axiom[guid_UInt64].str(), " {", Theorem_0003[LHS].str(), ", ", Theorem_0003[RHS].str(), " }" });
+	ProofVerified clones InTheoremStdStrVec as OutTheoremStdStrVec, and performs
+	the following operations:
 
-						// Commit for later fast-forward //
-						if (RHSRouteHistoryMap.find(Theorem_0003[RHS]) == RHSRouteHistoryMap.end())
-							RHSRouteHistoryMap.emplace(Theorem_0003[RHS], Theorem_0003);
-
-						// Attempt fast-forward //
-						if (LHSRouteHistoryMap.find(Theorem_0003[RHS]) != LHSRouteHistoryMap.end()) {
-							//std::cout << "Proof found in Module_0003 via Fast-Forward (FF)" << " {" << Theorem_0003[RHS].str() << ", " << Theorem_0003[RHS].str() << "}" << std::endl;
-							__stdlog__({ "Proof found in Module_0003 via Fast-Forward (FF)", " {", Theorem_0003[RHS].str(), ", ", Theorem_0003[RHS].str(), "}" });
-							auto opcode = LHSRouteHistoryMap[Theorem_0003[RHS]].begin() + ProofStackUInt64;
-							const auto OPCODE = LHSRouteHistoryMap[Theorem_0003[RHS]].end();
-							for (; opcode != OPCODE; ++opcode)
-								Theorem_0003.emplace_back(*opcode);
-							Theorem_0003[LHS] = Theorem_0003[RHS];
+	ProofVerified loops through Theorem, starting at Theorem[ProofStackUInt64],
+	and reads two values from the vector at a time: Theorem[ProofStackUInt64 + i++],
+	Theorem[ProofStackUInt64 + i++] - 1.
 
-							// Is the FF queue still empty? //
-							if (FastForwardTask_Thread.empty()) {
-								bFastForwardFlag = true;
-								FastForwardTask_Thread.push(Theorem_0003);
-								break;
-							}
-						}
-						Tasks_Thread.push(Theorem_0003);
-					}
+	The first value read out,
+	const auto& opcode = Theorem[ProofStackUInt64 + i++], is an opcode
+	whose hexadecimal value may range from 0x00 to 0x03.
 
-					__stdlog__({ "" });
-				} // end for (...Axiom : InAxiomsStdStrVec)
-			} // end test (...Theorem[LHS] == Theorem[RHS])
-		} // end for (...!Tasks_Thread.empty() && !QED))
+	The second value read out, const auto& guid = Theorem[ProofStackUInt64 + i++] - 1,
+	is an index into InAxiomsStdStrVec.
 
-		//*** End: Core Proof Engine (Loop) *** //
+	An opcode of 0x00 indicates a "lhsreduce" operation, which replaces all occurrences
+	of InAxiomsStdStrVec[guid][LHS] in OutTheoremStdStrVec[LHS] with InAxiomsStdStrVec[guid][RHS],
+	resizing OutTheoremStdStrVec, as required.
 
-		/*if (!QED)
-		{
-			if (TempProofSteps.size())
-			{
-				__stdlog__({ "Partial Proof Found." });
-			} else {
-				__stdlog__({ "No Proof Found." });
-			}
-		}*/
+	An opcode of 0x01 indicates a "lhsexpand" operation, which replaces all occurrences
+	of InAxiomsStdStrVec[guid][LHS] in OutTheoremStdStrVec[RHS] with InAxiomsStdStrVec[guid][LHS],
+	resizing OutTheoremStdStrVec, as required.
 
-		__stdtraceout__("STDThreadProve\n");
+	An opcode of 0x02 indicates a "rhsreduce" operation, which replaces all occurrences
+	of InAxiomsStdStrVec[guid][RHS] in OutTheoremStdStrVec[LHS] with InAxiomsStdStrVec[guid][RHS],
+	resizing OutTheoremStdStrVec, as required.
 
-		OutProofFound_FlagRef = QED;
+	An opcode of 0x03 indicates a "rhsexpand" operation, which replaces all occurrences
+	of InAxiomsStdStrVec[guid][RHS] in OutTheoremStdStrVec[RHS] with InAxiomsStdStrVec[guid][LHS],
+	resizing OutTheoremStdStrVec, as required.
 
-		//print_path(OutProofStepStdStrVecRef);
+	If ProofVerified is unable to complete the loop, the algorithm returns false.
+	*/
+	bool ProofVerified
+	(
+		const
+		std::vector<
+		BigInt128_t>&
+		InTheoremUInt64,
 
-		OutStatusReadyFlag = true; /* Set the Status Variable, last */
+		const
+		std::vector<
+		std::vector<
+		std::string>>&
+		InTheoremStdStrVec,
 
-		return true;
-	}
+		const
+		std::vector<
+		std::vector<
+		std::vector<
+		std::string>>>&
+		InAxiomsStdStrVec,
 
-	enum class /*API_EXPORT*/ BracketType { CurlyBraces, SquareBrackets, Parentheses };
+		std::vector<
+		std::vector<
+		std::vector<
+		std::string>>>&
+		OutProofStepStdStrVecRef,
+
+		std::vector<
+		std::vector<
+		std::string>>&
+		OutAxiomCommitLogStdStrVecRef
+	)
+	{
+		__stdtracein__("ProofVerified");
+
+		constexpr int LHS = 0;
+		constexpr int RHS = 1;
+		constexpr int ProofStackUInt64 = 4;
+
+		bool ReturnStatusFlag{true};
+
+		std::vector<
+			std::vector<
+			std::string>>
+			TempTheoremStdStrVec{ InTheoremStdStrVec };
+
+		//print_path(InTheoremStdStrVec);
+
+		std::vector<
+			std::string>
+			TempAxiomCommitLogStdStrVecRef;
+
+		/**
+		Loop through the Theorem's proofstack, which starts at Theorem[ProofStackUInt64],
+		and read off a pair of values from the vector:
+
+		1. An opcode whose hexadecimal value
+		ranges from 0x00 to 0x03 (See above for further explanation)
+
+		2. An index into InAxiomsStdStrVec, where guid is Axiom_[guid].
+		*/
+
+		std::size_t i { ProofStackUInt64 };
+
+		OutProofStepStdStrVecRef.push_back(TempTheoremStdStrVec);
+
+		while (i < InTheoremUInt64.size())
+		{
+			const std::size_t& opcode = std::size_t{ InTheoremUInt64[i++] };
+			const std::size_t& guid = std::size_t{ InTheoremUInt64[i++] - 1 };
+
+			// An axiom since removed, or taken offline, rewrites nothing //
+			if (guid >= InAxiomsStdStrVec.size() || InAxiomsStdStrVec[guid].size() < 2)
+			{
+				TempAxiomCommitLogStdStrVecRef.emplace_back("???? via Axiom_" + std::to_string(guid));
+				ReturnStatusFlag = false;
+			}
+			else switch (opcode)
+			{
+				case 0x00:
+				{ // "lhsreduce" operation //
+					__stdlog__({ "lhs_reduce via Axiom_", std::to_string(guid) });
+					ReturnStatusFlag =
+						Rewrite (TempTheoremStdStrVec[LHS], InAxiomsStdStrVec[guid][LHS], InAxiomsStdStrVec[guid][RHS]);
+					TempAxiomCommitLogStdStrVecRef.emplace_back("lhs_reduce via Axiom_" + std::to_string(guid));
+					break;
+				}
+				case 0x01:
+				{ // "lhsexpand" operation //
+					__stdlog__({ "lhs_expand via Axiom_", std::to_string(guid) });
+					ReturnStatusFlag =
+						Rewrite (TempTheoremStdStrVec[LHS], InAxiomsStdStrVec[guid][RHS], InAxiomsStdStrVec[guid][LHS]);
+					TempAxiomCommitLogStdStrVecRef.emplace_back("lhs_expand via Axiom_" + std::to_string(guid));
+					break;
+				}
+				case 0x02:
+				{ // "rhsreduce" operation //
+					__stdlog__({ "rhs_reduce via Axiom_", std::to_string(guid) });
+					ReturnStatusFlag =
+						Rewrite (TempTheoremStdStrVec[RHS], InAxiomsStdStrVec[guid][LHS], InAxiomsStdStrVec[guid][RHS]);
+					TempAxiomCommitLogStdStrVecRef.emplace_back("rhs_reduce via Axiom_" + std::to_string(guid));
+					break;
+				}
+				case 0x03:
+				{ // "rhsexpand" operation //
+					__stdlog__({ "rhs_expand via Axiom_", std::to_string(guid) });
+					ReturnStatusFlag =
+						Rewrite (TempTheoremStdStrVec[RHS], InAxiomsStdStrVec[guid][RHS], InAxiomsStdStrVec[guid][LHS]);
+					TempAxiomCommitLogStdStrVecRef.emplace_back("rhs_expand via Axiom_" + std::to_string(guid));
+					break;
+				}
+				default:
+				{
+					// Invalid opcode. //
+					TempAxiomCommitLogStdStrVecRef.emplace_back("???? via Axiom_" + std::to_string(guid));
+					break;
+				}
+			} // end switch(opcode)
+
+			// A lemma is never run backward //
+			if (ReturnStatusFlag && ( opcode & 0x01 ) && DirectedAxiom(InAxiomsStdStrVec[guid]))
+				ReturnStatusFlag = false;
+
+			OutProofStepStdStrVecRef.push_back(TempTheoremStdStrVec);
+
+			//print_path(TempTheoremStdStrVec);
+
+			if (!ReturnStatusFlag) 
+				break;
+		}
+		OutAxiomCommitLogStdStrVecRef.push_back(TempAxiomCommitLogStdStrVecRef);
+
+		//print_path(OutProofStepStdStrVecRef);
+
+		// If TentativeProofVerified is unable to finish the loop, return false.
+		__stdtraceout__("ProofVerified");
+		return ReturnStatusFlag;
+	}
+
+	void PackVarUInt64(std::string& OutStdStrRef, std::uint64_t InValue_UInt64)
+	{
+		while (InValue_UInt64 >= 0x80)
+		{
+			OutStdStrRef.push_back(static_cast<char>(( InValue_UInt64 & 0x7f ) | 0x80));
+			InValue_UInt64 >>= 7;
+		}
+		OutStdStrRef.push_back(static_cast<char>(InValue_UInt64));
+	}
+
+	std::uint64_t UnpackVarUInt64(const std::string& InStdStr, std::size_t& InOutOffset_UInt64)
+	{
+		std::uint64_t Value_UInt64{};
+		for (int Shift = 0; InOutOffset_UInt64 < InStdStr.size(); Shift += 7)
+		{
+			const unsigned char Byte = static_cast<unsigned char>(InStdStr[InOutOffset_UInt64++]);
+			Value_UInt64 |= std::uint64_t{ Byte & 0x7fu } << Shift;
+			if (( Byte & 0x80 ) == 0)
+				break;
+		}
+		return Value_UInt64;
+	}
+
+	void PackBigInt(std::string& OutStdStrRef, const BigInt128_t& InValue)
+	{
+		std::string Bytes_StdStr;
+		boost::multiprecision::export_bits(InValue, std::back_inserter(Bytes_StdStr), 8);
+		PackVarUInt64(OutStdStrRef, Bytes_StdStr.size());
+		OutStdStrRef.append(Bytes_StdStr);
+	}
+
+	BigInt128_t UnpackBigInt(const std::string& InStdStr, std::size_t& InOutOffset_UInt64)
+	{
+		const std::size_t Size_UInt64 = std::min(static_cast<std::size_t>(UnpackVarUInt64(InStdStr, InOutOffset_UInt64)), InStdStr.size() - InOutOffset_UInt64);
+		BigInt128_t Value{};
+		const unsigned char* Bytes = reinterpret_cast<const unsigned char*>(InStdStr.data()) + InOutOffset_UInt64;
+		if (Size_UInt64)
+			boost::multiprecision::import_bits(Value, Bytes, Bytes + Size_UInt64, 8);
+		InOutOffset_UInt64 += Size_UInt64;
+		return Value;
+	}
+
+	/**
+	 * PackProofTrace() : Pack a theorem node - [LHS][RHS][guid][last] as length-prefixed bytes,
+	 * then one varint (guid << 2 | opcode) per proof step.
+	 * usage: const std::string Packed_StdStr = PackProofTrace(Theorem); // Theorem == UnpackProofTrace(Packed_StdStr)
+	*/
+	std::string PackProofTrace(const std::vector<BigInt128_t>& InTheoremRef)
+	{
+		std::string Packed_StdStr;
+		for (std::size_t i = 0; i < 4; ++i)
+			PackBigInt(Packed_StdStr, InTheoremRef[i]);
+		for (std::size_t i = 4; i + 1 < InTheoremRef.size(); i += 2)
+			PackVarUInt64(Packed_StdStr, ( static_cast<std::uint64_t>(InTheoremRef[i + 1]) << 2 ) | static_cast<std::uint64_t>(InTheoremRef[i]));
+		return Packed_StdStr;
+	}
+
+	std::vector<BigInt128_t> UnpackProofTrace(const std::string& InStdStr)
+	{
+		std::vector<BigInt128_t> Theorem;
+		std::size_t Offset_UInt64{};
+		for (std::size_t i = 0; i < 4; ++i)
+			Theorem.emplace_back(UnpackBigInt(InStdStr, Offset_UInt64));
+		while (Offset_UInt64 < InStdStr.size())
+		{
+			const std::uint64_t Step_UInt64 = UnpackVarUInt64(InStdStr, Offset_UInt64);
+			Theorem.emplace_back(Step_UInt64 & 0x03);
+			Theorem.emplace_back(Step_UInt64 >> 2);
+		}
+		return Theorem;
+	}
+
+	/**
+	 * AxiomSetVersion() : Stable 64-bit FNV-1a hash of an axiom library's tokens; keys cached proofs to the axioms they used.
+	*/
+	std::uint64_t AxiomSetVersion
+	(
+		const
+		std::vector<
+		std::vector<
+		std::vector<
+		std::string>>>&
+		InAxiomsStdStrVec
+	)
+	{
+		std::uint64_t Hash_UInt64{ 0xcbf29ce484222325ULL };
+		auto HashByte = [&Hash_UInt64](const unsigned char InByte) -> void
+		{
+			Hash_UInt64 ^= InByte;
+			Hash_UInt64 *= 0x100000001b3ULL;
+		};
+		for (const std::vector<std::vector<std::string>>& Subnet_StdStrVec : InAxiomsStdStrVec)
+		{
+			for (const std::vector<std::string>& Expression_StdStrVec : Subnet_StdStrVec)
+			{
+				for (const std::string& Symbol_StdStr : Expression_StdStrVec)
+				{
+					for (const char c : Symbol_StdStr)
+						HashByte(static_cast<unsigned char>(c));
+					HashByte(0x1f); // unit separator //
+				}
+				HashByte(0x1e); // record separator //
+			}
+			HashByte(0x1d); // group separator //
+		}
+		return Hash_UInt64;
+	}
+
+	/**
+	 * AxiomSetVersion() : As above, extended by a cost per axiom, so that proofs cached under one cost model are not
+	 * returned under another. Without costs, the version is that of the axioms alone.
+	*/
+	std::uint64_t AxiomSetVersion
+	(
+		const
+		std::vector<
+		std::vector<
+		std::vector<
+		std::string>>>&
+		InAxiomsStdStrVec,
+
+		const
+		std::vector<
+		std::uint64_t>&
+		InAxiomCosts_UInt64Vec
+	)
+	{
+		std::uint64_t Hash_UInt64 = AxiomSetVersion(InAxiomsStdStrVec);
+		for (const std::uint64_t Cost_UInt64 : InAxiomCosts_UInt64Vec)
+		{
+			for (int Shift = 0; Shift < 64; Shift += 8)
+			{
+				Hash_UInt64 ^= ( Cost_UInt64 >> Shift ) & 0xff;
+				Hash_UInt64 *= 0x100000001b3ULL;
+			}
+		}
+		return Hash_UInt64;
+	}
+
+	/**
+	 * ProofCache : In-process LRU cache of solved proofs, shared by every EuclidProver instance.
+	 * Keyed by (axiom-set version, rebalanced LHS composite, rebalanced RHS composite); stores the packed proof trace,
+	 * which __Prove__ replays through ProofVerified to re-materialize the string proof steps on a hit.
+	 * Entries are evicted, least recently used first, once the cache exceeds its byte budget.
+	*/
+	class ProofCache
+	{
+	public:
+		explicit ProofCache(const std::size_t InByteBudget_UInt64 = std::size_t{ 64 } << 20) noexcept :
+			ByteBudget_UInt64{ InByteBudget_UInt64 }
+		{
+
+		}
+
+		bool Find
+		(
+			const std::uint64_t InAxiomSetVersion_UInt64,
+			const BigInt128_t& InLHS,
+			const BigInt128_t& InRHS,
+			std::vector<BigInt128_t>& OutTheoremRef
+		)
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			const auto it = Index.find(Key_Struct{ InAxiomSetVersion_UInt64, InLHS, InRHS });
+			if (it == Index.end())
+				return false;
+			Entries.splice(Entries.begin(), Entries, it->second);
+			OutTheoremRef = UnpackProofTrace(it->second->PackedTraceStdStr);
+			return true;
+		}
+
+		void Insert
+		(
+			const std::uint64_t InAxiomSetVersion_UInt64,
+			const BigInt128_t& InLHS,
+			const BigInt128_t& InRHS,
+			const std::vector<BigInt128_t>& InTheoremRef
+		)
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			Key_Struct Key{ InAxiomSetVersion_UInt64, InLHS, InRHS };
+			if (Index.find(Key) != Index.end())
+				return;
+
+			Entry_Struct Entry{ Key, PackProofTrace(InTheoremRef), 0 };
+			Entry.Bytes_UInt64 = sizeof(Entry_Struct) + Entry.PackedTraceStdStr.size() +
+				( InLHS.backend().size() + InRHS.backend().size() ) * sizeof(boost::multiprecision::limb_type);
+			if (Entry.Bytes_UInt64 > ByteBudget_UInt64)
+				return;
+
+			Bytes_UInt64 += Entry.Bytes_UInt64;
+			Entries.emplace_front(std::move(Entry));
+			Index.emplace(std::move(Key), Entries.begin());
+			Evict();
+		}
+
+		void SetByteBudget(const std::size_t InByteBudget_UInt64)
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			ByteBudget_UInt64 = InByteBudget_UInt64;
+			Evict();
+		}
+
+		void Clear()
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			Index.clear();
+			Entries.clear();
+			Bytes_UInt64 = 0;
+		}
+
+		std::size_t size()
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			return Entries.size();
+		}
+
+	private:
+		struct Key_Struct
+		{
+			std::uint64_t AxiomSetVersion_UInt64{};
+			BigInt128_t LHS;
+			BigInt128_t RHS;
+
+			bool operator==(const Key_Struct& InKeyRef) const
+			{
+				return AxiomSetVersion_UInt64 == InKeyRef.AxiomSetVersion_UInt64 && LHS == InKeyRef.LHS && RHS == InKeyRef.RHS;
+			}
+		};
+
+		struct KeyHash_Struct
+		{
+			std::size_t operator()(const Key_Struct& InKeyRef) const
+			{
+				std::size_t Hash_UInt64 = std::hash<std::uint64_t>{}(InKeyRef.AxiomSetVersion_UInt64);
+				Hash_UInt64 ^= std::hash<BigInt128_t>{}(InKeyRef.LHS) + 0x9e3779b97f4a7c15ULL + ( Hash_UInt64 << 6 ) + ( Hash_UInt64 >> 2 );
+				Hash_UInt64 ^= std::hash<BigInt128_t>{}(InKeyRef.RHS) + 0x9e3779b97f4a7c15ULL + ( Hash_UInt64 << 6 ) + ( Hash_UInt64 >> 2 );
+				return Hash_UInt64;
+			}
+		};
+
+		struct Entry_Struct
+		{
+			Key_Struct Key;
+			std::string PackedTraceStdStr;
+			std::size_t Bytes_UInt64{};
+		};
+
+		void Evict()
+		{
+			while (Bytes_UInt64 > ByteBudget_UInt64 && !Entries.empty())
+			{
+				Bytes_UInt64 -= Entries.back().Bytes_UInt64;
+				Index.erase(Entries.back().Key);
+				Entries.pop_back();
+			}
+		}
+
+		std::mutex Mutex;
+		std::size_t ByteBudget_UInt64;
+		std::size_t Bytes_UInt64{};
+		std::list<Entry_Struct> Entries;
+		std::unordered_map<Key_Struct, std::list<Entry_Struct>::iterator, KeyHash_Struct> Index;
+	};
+
+	ProofCache ProofCacheGlobal{};
+
+	/**
+	 * RestoreSymbolTable() : Replace the symbol table with a checkpoint's, so that its theorem and axioms re-encode onto the
+	 * suspended composites. InRunningRef is the resumed search's own guard; refused (false) while any other search runs
+	 * (see SearchGuard), or when the section is truncated.
+	*/
+	bool RestoreSymbolTable(const MappedFile& InBlobRef, const SearchGuard& /*InRunningRef*/)
+	{
+		CheckpointReader Reader;
+		const std::uint64_t I = OpenCheckpointSection(InBlobRef, CheckpointSection_EnumClass::Symbols, Reader);
+		if (Reader.OverrunFlag)
+			return false;
+
+		std::unordered_multimap<std::string, BigInt128_t> SymbolToPrime;
+		std::vector<BigInt128_t> Primes_UInt64Vec;
+		for (std::uint64_t i = 0; i < I && !Reader.OverrunFlag; ++i)
+		{
+			std::string Symbol_StdStr = Reader.ReadStdStr();
+			const BigInt128_t p = Reader.ReadBigInt();
+			SymbolToPrime.emplace(std::move(Symbol_StdStr), p);
+			Primes_UInt64Vec.emplace_back(p);
+		}
+		if (Reader.OverrunFlag)
+			return false;
+		std::sort(Primes_UInt64Vec.begin(), Primes_UInt64Vec.end());
+
+		const std::lock_guard<std::mutex> Lock(SymbolTableMutex);
+		if (ActiveSearches_UInt64 > 1)
+		{
+			__stdlog__({ "RestoreSymbolTable: refused, ", std::to_string(ActiveSearches_UInt64 - 1), " other searches running" });
+			return false;
+		}
+		SymbolToPrime_UInt64MultiMap = std::move(SymbolToPrime);
+		PrimeComposite_UInt64Vec = std::move(Primes_UInt64Vec);
+		PrimeCompositeVecSize_UInt64 = PrimeComposite_UInt64Vec.size();
+		++SymbolTableGeneration_UInt64;
+
+		// Cached composites were encoded against the replaced symbol table //
+		ProofCacheGlobal.Clear();
+		return true;
+	}
+
+	/**
+	 * TheoremTokenKey() : Canonical token form of a theorem (tokens joined by US, subnets by RS),
+	 * the stable identity ProofStore files a solved theorem under.
+	*/
+	std::string TheoremTokenKey
+	(
+		const
+		std::vector<
+		std::vector<
+		std::string>>&
+		InTheoremStdStrVec
+	)
+	{
+		std::string Key_StdStr;
+		for (const std::vector<std::string>& Subnet_StdStrVec : InTheoremStdStrVec)
+		{
+			for (const std::string& Symbol_StdStr : Subnet_StdStrVec)
+			{
+				Key_StdStr.append(Symbol_StdStr);
+				Key_StdStr.push_back('\x1f'); // unit separator //
+			}
+			Key_StdStr.push_back('\x1e'); // record separator //
+		}
+		return Key_StdStr;
+	}
+
+	std::uint64_t Fnv1a64(const std::string& InStdStr) noexcept
+	{
+		std::uint64_t Hash_UInt64{ 0xcbf29ce484222325ULL };
+		for (const char c : InStdStr)
+		{
+			Hash_UInt64 ^= static_cast<unsigned char>(c);
+			Hash_UInt64 *= 0x100000001b3ULL;
+		}
+		return Hash_UInt64;
+	}
+
+	/**
+	 * ProofStore : Content-addressed, on-disk store of solved proofs ("proof-statement hash as a file handle").
+	 *
+	 * <directory>/proofs.dat  Append-only records: [TheoremKey][AxiomKey][token key][packed proof trace]
+	 * <directory>/proofs.idx  Open-addressing hash table of ProofStoreSlot_Struct, memory-mapped for lookups
+	 * <directory>/proofs.lock Advisory-locked (flock / LockFileEx) by a writer for the duration of an Insert;
+	 *                         the OS releases the lock should the writer die holding it
+	 *
+	 * Records are filed under (Fnv1a64 of the theorem's canonical token form, AxiomSetVersion), neither of which
+	 * depends on this process' prime assignment, so proofs survive restarts and are shared by every worker on the host.
+	 * The index header's generation is a seqlock: a writer makes it odd while it rewrites a slot in place, and even again
+	 * after. A reader remaps the files only when the generation has moved, and retries a probe it saw the generation move under.
+	 * usage: ProofStore& Store = OpenProofStore("proofs"); Store.Find(TheoremStdStrVec, AxiomSetVersion_UInt64, Theorem);
+	*/
+	class ProofStore
+	{
+	public:
+		explicit ProofStore(const std::string& InDirectoryStdStr) :
+			DirectoryStdStr{ InDirectoryStdStr },
+			IndexPathStdStr{ ( std::filesystem::path(InDirectoryStdStr) / "proofs.idx" ).string() },
+			DataPathStdStr{ ( std::filesystem::path(InDirectoryStdStr) / "proofs.dat" ).string() },
+			LockPathStdStr{ ( std::filesystem::path(InDirectoryStdStr) / "proofs.lock" ).string() }
+		{
+			std::error_code ec;
+			std::filesystem::create_directories(DirectoryStdStr, ec);
+		}
+
+		ProofStore(const ProofStore&) = delete;
+		ProofStore& operator=(const ProofStore&) = delete;
+
+		~ProofStore()
+		{
+#ifdef _WIN32
+			if (LockHandle != INVALID_HANDLE_VALUE)
+				CloseHandle(LockHandle);
+#else
+			if (LockDescriptor >= 0)
+				close(LockDescriptor);
+#endif
+		}
+
+		bool Find
+		(
+			const std::vector<std::vector<std::string>>& InTheoremStdStrVec,
+			const std::uint64_t InAxiomSetVersion_UInt64,
+			std::vector<BigInt128_t>& OutTheoremRef
+		)
+		{
+			__stdtracein__("ProofStore::Find");
+			std::lock_guard<std::mutex> Lock(Mutex);
+			const std::string TokenKey_StdStr = TheoremTokenKey(InTheoremStdStrVec);
+			const std::uint64_t TheoremKey_UInt64 = Fnv1a64(TokenKey_StdStr);
+
+			bool bFoundFlag{};
+			for (int Attempt = 0; Attempt < 64; ++Attempt)
+			{
+				// Another worker has inserted since the files were mapped, or replaced the index: map them afresh //
+				std::uint64_t Generation_UInt64 = LiveGeneration();
+				if (Generation_UInt64 != MappedGeneration_UInt64 || Generation_UInt64 & 1)
+				{
+					Remap();
+					Generation_UInt64 = MappedGeneration_UInt64;
+				}
+				if (!Index->valid())
+					break;
+				if (Generation_UInt64 & 1)
+				{
+					std::this_thread::yield();
+					continue;
+				}
+
+				bFoundFlag = FindMapped(TheoremKey_UInt64, InAxiomSetVersion_UInt64, TokenKey_StdStr, OutTheoremRef);
+
+				// A slot rewritten under the probe may have been read torn //
+				if (LiveGeneration() == Generation_UInt64)
+					break;
+				bFoundFlag = false;
+			}
+
+			__stdtraceout__("ProofStore::Find");
+			return bFoundFlag;
+		}
+
+		bool Insert
+		(
+			const std::vector<std::vector<std::string>>& InTheoremStdStrVec,
+			const std::uint64_t InAxiomSetVersion_UInt64,
+			const std::vector<BigInt128_t>& InTheoremRef
+		)
+		{
+			__stdtracein__("ProofStore::Insert");
+			std::lock_guard<std::mutex> Lock(Mutex);
+			bool bSuccessFlag{};
+
+			if (AcquireFileLock())
+			{
+				const std::string TokenKey_StdStr = TheoremTokenKey(InTheoremStdStrVec);
+				const std::uint64_t TheoremKey_UInt64 = Fnv1a64(TokenKey_StdStr);
+				std::vector<BigInt128_t> Existing;
+
+				Remap();
+				if (FindMapped(TheoremKey_UInt64, InAxiomSetVersion_UInt64, TokenKey_StdStr, Existing))
+				{
+					bSuccessFlag = true;
+				} else {
+					ProofStoreSlot_Struct Slot{ TheoremKey_UInt64, InAxiomSetVersion_UInt64, 0, 0 };
+					if (AppendRecord(Slot, TokenKey_StdStr, PackProofTrace(InTheoremRef)))
+						bSuccessFlag = InsertSlot(Slot);
+				}
+				ReleaseFileLock();
+				Remap();
+			}
+
+			__stdtraceout__("ProofStore::Insert");
+			return bSuccessFlag;
+		}
+
+	private:
+		struct ProofStoreHeader_Struct
+		{
+			char Magic[8]{ 'E', 'U', 'C', 'L', 'I', 'D', 'P', '2' };
+			std::uint64_t SlotCount_UInt64{};
+			std::uint64_t UsedSlots_UInt64{};
+
+			// Even while the index is stable, odd while a slot is rewritten; SupersededGeneration_UInt64 once a rebuilt index replaced the file //
+			std::uint64_t Generation_UInt64{};
+		};
+
+		static constexpr std::uint64_t SupersededGeneration_UInt64{ ~std::uint64_t{ 0 } };
+
+		// An empty slot has Length_UInt64 == 0 //
+		struct ProofStoreSlot_Struct
+		{
+			std::uint64_t TheoremKey_UInt64{};
+			std::uint64_t AxiomKey_UInt64{};
+			std::uint64_t Offset_UInt64{};
+			std::uint64_t Length_UInt64{};
+		};
+
+		static constexpr std::uint64_t InitialSlots_UInt64{ 1 << 12 };
+
+		std::mutex Mutex;
+		const std::string DirectoryStdStr;
+		const std::string IndexPathStdStr;
+		const std::string DataPathStdStr;
+		const std::string LockPathStdStr;
+		std::unique_ptr<MappedFile> Index;
+		std::unique_ptr<MappedFile> Data;
+		std::uint64_t MappedGeneration_UInt64{ SupersededGeneration_UInt64 };
+#ifdef _WIN32
+		HANDLE LockHandle{ INVALID_HANDLE_VALUE };
+#else
+		int LockDescriptor{ -1 };
+#endif
+
+		void Remap()
+		{
+			Index = std::make_unique<MappedFile>(IndexPathStdStr);
+			Data = std::make_unique<MappedFile>(DataPathStdStr);
+			MappedGeneration_UInt64 = LiveGeneration();
+		}
+
+		// The generation in the mapped index header, as another process last wrote it (SupersededGeneration_UInt64: nothing mapped) //
+		std::uint64_t LiveGeneration() const
+		{
+			if (!Index || !Index->valid() || Index->size() < sizeof(ProofStoreHeader_Struct))
+				return SupersededGeneration_UInt64;
+			std::uint64_t Generation_UInt64{};
+			std::atomic_thread_fence(std::memory_order_acquire);
+			std::memcpy(&Generation_UInt64, Index->data() + offsetof(ProofStoreHeader_Struct, Generation_UInt64), sizeof(Generation_UInt64));
+			std::atomic_thread_fence(std::memory_order_acquire);
+			return Generation_UInt64;
+		}
+
+		bool ReadHeader(ProofStoreHeader_Struct& OutHeaderRef) const
+		{
+			if (!Index || !Index->valid() || Index->size() < sizeof(ProofStoreHeader_Struct))
+				return false;
+			std::memcpy(&OutHeaderRef, Index->data(), sizeof(OutHeaderRef));
+			const ProofStoreHeader_Struct Expected{};
+			return std::memcmp(OutHeaderRef.Magic, Expected.Magic, sizeof(Expected.Magic)) == 0 &&
+				OutHeaderRef.SlotCount_UInt64 &&
+				Index->size() >= sizeof(ProofStoreHeader_Struct) + OutHeaderRef.SlotCount_UInt64 * sizeof(ProofStoreSlot_Struct);
+		}
+
+		bool FindMapped
+		(
+			const std::uint64_t InTheoremKey_UInt64,
+			const std::uint64_t InAxiomKey_UInt64,
+			const std::string& InTokenKeyStdStr,
+			std::vector<BigInt128_t>& OutTheoremRef
+		) const
+		{
+			ProofStoreHeader_Struct Header{};
+			if (!ReadHeader(Header) || !Data || !Data->valid())
+				return false;
+
+			const unsigned char* Slots = Index->data() + sizeof(ProofStoreHeader_Struct);
+			const std::uint64_t Mask_UInt64 = Header.SlotCount_UInt64 - 1;
+			for (std::uint64_t i = ( InTheoremKey_UInt64 ^ InAxiomKey_UInt64 ) & Mask_UInt64, n = 0; n < Header.SlotCount_UInt64; i = ( i + 1 ) & Mask_UInt64, ++n)
+			{
+				ProofStoreSlot_Struct Slot{};
+				std::memcpy(&Slot, Slots + i * sizeof(ProofStoreSlot_Struct), sizeof(Slot));
+				if (Slot.Length_UInt64 == 0)
+					return false;
+				if (Slot.TheoremKey_UInt64 != InTheoremKey_UInt64 || Slot.AxiomKey_UInt64 != InAxiomKey_UInt64)
+					continue;
+				if (Slot.Offset_UInt64 + Slot.Length_UInt64 > Data->size())
+					return false;
+
+				// Guard against hash collisions with the stored token key //
+				CheckpointReader Reader{ Data->data() + Slot.Offset_UInt64 + 2 * sizeof(std::uint64_t), Data->data() + Slot.Offset_UInt64 + Slot.Length_UInt64 };
+				if (Reader.ReadStdStr() != InTokenKeyStdStr)
+					continue;
+				const std::string PackedTrace_StdStr = Reader.ReadStdStr();
+				if (Reader.OverrunFlag)
+					return false;
+				OutTheoremRef = UnpackProofTrace(PackedTrace_StdStr);
+				return true;
+			}
+			return false;
+		}
+
+		bool AppendRecord(ProofStoreSlot_Struct& InOutSlotRef, const std::string& InTokenKeyStdStr, const std::string& InPackedTraceStdStr)
+		{
+			std::ofstream DataFile(DataPathStdStr, std::ios::binary | std::ios::app);
+			DataFile.seekp(0, std::ios::end);
+			InOutSlotRef.Offset_UInt64 = static_cast<std::uint64_t>(DataFile.tellp());
+			CheckpointWriteUInt64(DataFile, InOutSlotRef.TheoremKey_UInt64);
+			CheckpointWriteUInt64(DataFile, InOutSlotRef.AxiomKey_UInt64);
+			CheckpointWriteStdStr(DataFile, InTokenKeyStdStr);
+			CheckpointWriteStdStr(DataFile, InPackedTraceStdStr);
+			InOutSlotRef.Length_UInt64 = static_cast<std::uint64_t>(DataFile.tellp()) - InOutSlotRef.Offset_UInt64;
+			return static_cast<bool>(DataFile);
+		}
+
+		// Rewrite the index with InSlotCount_UInt64 slots (a power of 2), re-homing every used slot //
+		bool RebuildIndex(const std::uint64_t InSlotCount_UInt64, std::vector<ProofStoreSlot_Struct> InSlots, const std::uint64_t InGeneration_UInt64)
+		{
+			std::vector<ProofStoreSlot_Struct> Table(static_cast<std::size_t>(InSlotCount_UInt64));
+			ProofStoreHeader_Struct Header{};
+			Header.SlotCount_UInt64 = InSlotCount_UInt64;
+			Header.Generation_UInt64 = InGeneration_UInt64;
+			for (const ProofStoreSlot_Struct& Slot : InSlots)
+			{
+				std::uint64_t i = ( Slot.TheoremKey_UInt64 ^ Slot.AxiomKey_UInt64 ) & ( InSlotCount_UInt64 - 1 );
+				while (Table[static_cast<std::size_t>(i)].Length_UInt64)
+					i = ( i + 1 ) & ( InSlotCount_UInt64 - 1 );
+				Table[static_cast<std::size_t>(i)] = Slot;
+				++Header.UsedSlots_UInt64;
+			}
+
+			const std::string TempPath_StdStr = IndexPathStdStr + ".tmp";
+			{
+				std::ofstream IndexFile(TempPath_StdStr, std::ios::binary | std::ios::trunc);
+				IndexFile.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+				IndexFile.write(reinterpret_cast<const char*>(Table.data()), static_cast<std::streamsize>(Table.size() * sizeof(ProofStoreSlot_Struct)));
+				IndexFile.close();
+				if (!IndexFile)
+					return false;
+			}
+			Index.reset();
+
+			// Readers still mapping the replaced index see it superseded, and remap //
+			if (std::filesystem::exists(IndexPathStdStr))
+			{
+				std::fstream IndexFile(IndexPathStdStr, std::ios::binary | std::ios::in | std::ios::out);
+				IndexFile.seekp(static_cast<std::streamoff>(offsetof(ProofStoreHeader_Struct, Generation_UInt64)));
+				IndexFile.write(reinterpret_cast<const char*>(&SupersededGeneration_UInt64), sizeof(SupersededGeneration_UInt64));
+			}
+
+			std::error_code ec;
+			std::filesystem::rename(TempPath_StdStr, IndexPathStdStr, ec);
+			return !ec;
+		}
+
+		bool InsertSlot(const ProofStoreSlot_Struct& InSlotRef)
+		{
+			ProofStoreHeader_Struct Header{};
+			std::vector<ProofStoreSlot_Struct> Slots;
+			if (ReadHeader(Header))
+			{
+				Slots.resize(static_cast<std::size_t>(Header.SlotCount_UInt64));
+				std::memcpy(Slots.data(), Index->data() + sizeof(Header), Slots.size() * sizeof(ProofStoreSlot_Struct));
+			}
+
+			// Keep the load factor under 1/2, so that probes stay short //
+			if (Slots.empty() || ( Header.UsedSlots_UInt64 + 1 ) * 2 > Header.SlotCount_UInt64)
+			{
+				std::vector<ProofStoreSlot_Struct> Used;
+				for (const ProofStoreSlot_Struct& Slot : Slots)
+					if (Slot.Length_UInt64)
+						Used.emplace_back(Slot);
+				Used.emplace_back(InSlotRef);
+				return RebuildIndex(std::max(InitialSlots_UInt64, Header.SlotCount_UInt64 * 2), std::move(Used), ( Header.Generation_UInt64 | 1 ) + 1);
+			}
+
+			std::uint64_t i = ( InSlotRef.TheoremKey_UInt64 ^ InSlotRef.AxiomKey_UInt64 ) & ( Header.SlotCount_UInt64 - 1 );
+			while (Slots[static_cast<std::size_t>(i)].Length_UInt64)
+				i = ( i + 1 ) & ( Header.SlotCount_UInt64 - 1 );
+			++Header.UsedSlots_UInt64;
+
+			// Seqlock: odd generation, the slot, then the next even generation - each flushed, so a reader sees them in order //
+			Index.reset();
+			std::fstream IndexFile(IndexPathStdStr, std::ios::binary | std::ios::in | std::ios::out);
+			Header.Generation_UInt64 |= 1;
+			IndexFile.seekp(0);
+			IndexFile.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+			IndexFile.flush();
+			IndexFile.seekp(static_cast<std::streamoff>(sizeof(Header) + i * sizeof(ProofStoreSlot_Struct)));
+			IndexFile.write(reinterpret_cast<const char*>(&InSlotRef), sizeof(InSlotRef));
+			IndexFile.flush();
+			++Header.Generation_UInt64;
+			IndexFile.seekp(0);
+			IndexFile.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+			IndexFile.flush();
+			return static_cast<bool>(IndexFile);
+		}
+
+		// An OS advisory lock on proofs.lock, so that a writer which dies holding it does not lock the store for good //
+		bool AcquireFileLock()
+		{
+#ifdef _WIN32
+			if (LockHandle == INVALID_HANDLE_VALUE)
+				LockHandle = CreateFileA(LockPathStdStr.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (LockHandle == INVALID_HANDLE_VALUE)
+				return false;
+#else
+			if (LockDescriptor < 0)
+				LockDescriptor = open(LockPathStdStr.c_str(), O_RDWR | O_CREAT, 0644);
+			if (LockDescriptor < 0)
+				return false;
+#endif
+			for (int Attempt = 0; Attempt < 2000; ++Attempt)
+			{
+#ifdef _WIN32
+				OVERLAPPED Overlapped{};
+				if (LockFileEx(LockHandle, LOCKFILE_EXCLUSIVE_LOCK | LOCKFILE_FAIL_IMMEDIATELY, 0, 1, 0, &Overlapped))
+					return true;
+#else
+				if (flock(LockDescriptor, LOCK_EX | LOCK_NB) == 0)
+					return true;
+#endif
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+			return false;
+		}
+
+		void ReleaseFileLock()
+		{
+#ifdef _WIN32
+			OVERLAPPED Overlapped{};
+			UnlockFileEx(LockHandle, 0, 1, 0, &Overlapped);
+#else
+			flock(LockDescriptor, LOCK_UN);
+#endif
+		}
+	};
+
+	/**
+	 * OpenProofStore() : The process-wide ProofStore for a directory (opened on first use).
+	*/
+	ProofStore& OpenProofStore(const std::string& InDirectoryStdStr)
+	{
+		static std::mutex StoresMutex;
+		static std::unordered_map<std::string, std::unique_ptr<ProofStore>> Stores;
+		std::lock_guard<std::mutex> Lock(StoresMutex);
+		std::unique_ptr<ProofStore>& Store = Stores[InDirectoryStdStr];
+		if (!Store)
+			Store = std::make_unique<ProofStore>(InDirectoryStdStr);
+		return *Store;
+	}
+
+	/**
+	 * StandbyRewriteThread : Background worker for overflow rewrites (Tasks_Thread stays small and cache-resident).
+	 *
+	 * Defer() hands the least promising nodes to the worker, together with the nodes __Prove__ has closed since the last
+	 * hand-off. The worker packs each node exactly - composites as length-prefixed bytes, and the proof stack as one varint
+	 * per step (guid << 2 | opcode) - and drops a deferred node only when the very same node, proof stack and all, is already
+	 * deferred or closed. Nodes which merely share their composites are kept: their token orders may differ, and ProofVerified,
+	 * which replays the tokens, may accept one and reject another.
+	 * Reclaim() waits for the worker to go idle, and feeds the surviving nodes back once the primary frontier runs dry.
+	*/
+	class StandbyRewriteThread
+	{
+	public:
+		using Node = std::vector<BigInt128_t>;
+
+		StandbyRewriteThread() = default;
+		StandbyRewriteThread(const StandbyRewriteThread&) = delete;
+		StandbyRewriteThread& operator=(const StandbyRewriteThread&) = delete;
+
+		~StandbyRewriteThread()
+		{
+			{
+				std::lock_guard<std::mutex> Lock(Mutex);
+				bStopFlag = true;
+			}
+			WorkReadyCV.notify_all();
+			if (Worker.joinable())
+				Worker.join();
+		}
+
+		// True from a Defer() to the next Reclaim(): closed nodes are worth handing over only while deferred nodes wait //
+		bool pending() const noexcept { return bPendingFlag; }
+
+		void Defer(std::vector<Node>&& InNodes, std::vector<Node>& InOutClosedNodes)
+		{
+			__stdtracein__("StandbyRewriteThread::Defer");
+			{
+				std::lock_guard<std::mutex> Lock(Mutex);
+				if (!Worker.joinable())
+					Worker = std::thread(&StandbyRewriteThread::Run, this);
+				for (Node& InNode : InNodes)
+					Inbox.emplace_back(std::move(InNode));
+				for (Node& InNode : InOutClosedNodes)
+					InboxClosed.emplace_back(std::move(InNode));
+				InOutClosedNodes.clear();
+			}
+			bPendingFlag = true;
+			WorkReadyCV.notify_one();
+			__stdtraceout__("StandbyRewriteThread::Defer");
+		}
+
+		// Push every surviving deferred node onto OutFrontierRef; returns false when nothing was deferred //
+		template <typename Frontier>
+		bool Reclaim(Frontier& OutFrontierRef, std::vector<Node>& InOutClosedNodes)
+		{
+			if (!Worker.joinable())
+				return false;
+
+			__stdtracein__("StandbyRewriteThread::Reclaim");
+			std::unordered_set<std::string> TempDeferred;
+			{
+				std::unique_lock<std::mutex> Lock(Mutex);
+				for (Node& InNode : InOutClosedNodes)
+					InboxClosed.emplace_back(std::move(InNode));
+				InOutClosedNodes.clear();
+				WorkReadyCV.notify_one();
+				IdleCV.wait(Lock, [&] { return Inbox.empty() && InboxClosed.empty() && !bBusyFlag; });
+				TempDeferred.swap(Deferred);
+
+				// Nothing waits on them now; dropping fewer nodes later is always safe //
+				Closed.clear();
+			}
+			bPendingFlag = false;
+
+			bool bReclaimedFlag{};
+			for (const std::string& Packed_StdStr : TempDeferred)
+			{
+				OutFrontierRef.push(UnpackProofTrace(Packed_StdStr));
+				bReclaimedFlag = true;
+			}
+			__stdtraceout__("StandbyRewriteThread::Reclaim");
+			return bReclaimedFlag;
+		}
+
+	private:
+		std::thread Worker;
+		std::mutex Mutex;
+		std::condition_variable WorkReadyCV;
+		std::condition_variable IdleCV;
+		bool bStopFlag{};
+		bool bBusyFlag{};
+
+		// Owned by the caller's thread //
+		bool bPendingFlag{};
+
+		std::vector<Node> Inbox;
+		std::vector<Node> InboxClosed;
+
+		// Worker-owned (guarded by Mutex while Reclaim swaps them out): packed traces of the closed and the deferred nodes //
+		std::unordered_set<std::string> Closed;
+		std::unordered_set<std::string> Deferred;
+
+		void Run()
+		{
+			std::unique_lock<std::mutex> Lock(Mutex);
+			while (true)
+			{
+				WorkReadyCV.wait(Lock, [&] { return bStopFlag || !Inbox.empty() || !InboxClosed.empty(); });
+				if (bStopFlag)
+					return;
+
+				std::vector<Node> TempInbox;
+				std::vector<Node> TempClosed;
+				TempInbox.swap(Inbox);
+				TempClosed.swap(InboxClosed);
+				bBusyFlag = true;
+				Lock.unlock();
+
+				// A deferred node the search has since closed would only be expanded again, exactly as it was //
+				for (const Node& InNode : TempClosed)
+				{
+					std::string Packed_StdStr = PackProofTrace(InNode);
+					Deferred.erase(Packed_StdStr);
+					Closed.emplace(std::move(Packed_StdStr));
+				}
+
+				std::vector<std::string> TempPacked;
+				for (const Node& InNode : TempInbox)
+				{
+					std::string Packed_StdStr = PackProofTrace(InNode);
+					if (!Closed.count(Packed_StdStr))
+						TempPacked.emplace_back(std::move(Packed_StdStr));
+				}
+
+				Lock.lock();
+				for (std::string& Packed_StdStr : TempPacked)
+					Deferred.emplace(std::move(Packed_StdStr));
+				bBusyFlag = false;
+				IdleCV.notify_all();
+			}
+		}
+	};
+
+	/**
+	 * RegisterSymbols() : Assign a prime to every symbol of InTheoremStdStrVec not yet in SymbolToPrime_UInt64MultiMap.
+	 * Once every symbol is registered, encoding only reads the symbol table, so proofs may run concurrently. Symbols are
+	 * added under SymbolTableMutex, as by EncodeAxioms(), which RestoreSymbolTable() also takes.
+	*/
+	void RegisterSymbols
+	(
+		const
+		std::vector<
+		std::vector<
+		std::string>>&
+		InTheoremStdStrVec
+	)
+	{
+		const std::lock_guard<std::mutex> Lock(SymbolTableMutex);
+		for (const std::vector<std::string>& Subnet_StdStrVec : InTheoremStdStrVec)
+			for (const std::string& Symbol_StdStr : Subnet_StdStrVec)
+				if (SymbolToPrime_UInt64MultiMap.find(Symbol_StdStr) == SymbolToPrime_UInt64MultiMap.end())
+					SymbolToPrime_UInt64MultiMap.emplace(Symbol_StdStr, Prime());
+	}
+
+	/**
+	 * EncodeSubnet() : The prime composite of a token subnet; every symbol must already be registered (RegisterSymbols).
+	*/
+	BigInt128_t EncodeSubnet
+	(
+		const
+		std::vector<
+		std::string>&
+		InSubnetStdStrVec
+	)
+	{
+		BigInt128_t PrimeProduct_UInt64Vec{ 1 };
+		for (const std::string& Symbol_StdStr : InSubnetStdStrVec)
+			PrimeProduct_UInt64Vec *= SymbolToPrime_UInt64MultiMap.find(Symbol_StdStr)->second;
+		return PrimeProduct_UInt64Vec;
+	}
+
+	/**
+	 * RebalancedAxiom() : An axiom encoded as written, rebalanced: the larger composite as its LHS, and a directed rule's
+	 * parity flipped with its sides (see DirectionAllowed). An empty (removed) axiom, [guid], is returned as is.
+	*/
+	std::vector<BigInt128_t> RebalancedAxiom(std::vector<BigInt128_t> InAxiom)
+	{
+		if (InAxiom.size() > 2 && InAxiom[0] < InAxiom[1])
+		{
+			std::swap(InAxiom[0], InAxiom[1]);
+			if (InAxiom.size() > 3)
+				InAxiom[3] = 0x01;
+		}
+		return InAxiom;
+	}
+
+	/**
+	 * EncodeAxioms() : Encode an axiom library as [LHS][RHS][guid] prime composites (guid is 1-based);
+	 * rebalanced (the larger composite as LHS) unless InRebalanceFlag is false. A directed rule has a fourth element,
+	 * the parity of the opcodes that run it (see DirectionAllowed).
+	 * usage: const std::vector<std::vector<BigInt128_t>> Axioms_UInt64Vec = EncodeAxioms(AxiomsStdStrVec);
+	*/
+	std::vector<
+		std::vector<
+		BigInt128_t>> EncodeAxioms
+	(
+		const
+		std::vector<
+		std::vector<
+		std::vector<
+		std::string>>>&
+		InAxiomsStdStrVec,
+
+		const bool InRebalanceFlag = true
+	)
+	{
+		__stdtracein__("EncodeAxioms");
+
+		const std::lock_guard<std::mutex> Lock(SymbolTableMutex);
+
+		BigInt128_t GUID_UInt64{};
+
+		std::vector<
+			std::vector<
+			BigInt128_t>> Axioms_UInt64Vec;
+
+		for
+			(
+				const
+				std::vector<
+				std::vector<
+				std::string>>&Subnet_StdStrVec :
+				InAxiomsStdStrVec
+			)
+		{
+			std::vector<BigInt128_t> TempInnerAxiom_UInt64Vec{};
+			for
+				(
+					const
+					std::vector<
+					std::string>& Expression_StdStrVec :
+					std::span(Subnet_StdStrVec).first(std::min<std::size_t>(Subnet_StdStrVec.size(), 2))
+				)
+			{
+				BigInt128_t PrimeProduct_UInt64Vec{ 1 };
+				for (const std::string& Symbol_StdStr : Expression_StdStrVec)
+				{
+					__stdlog__({ "'",Symbol_StdStr,"' " });
+					const auto& it = SymbolToPrime_UInt64MultiMap.find(Symbol_StdStr);
+					if (it != SymbolToPrime_UInt64MultiMap.end())
+					{
+						PrimeProduct_UInt64Vec *= it->second;
+						__stdlog__({ "Prime: ", Symbol_StdStr ," <- ",it->second.str(),", PrimeProduct: ", PrimeProduct_UInt64Vec.str() });
+					} else {
+						// This key/value pair is not in the prime number multimap...
+						const BigInt128_t p = Prime();
+						SymbolToPrime_UInt64MultiMap.emplace(Symbol_StdStr, p);
+						PrimeProduct_UInt64Vec *= p;
+						__stdlog__({ "New Prime: ", Symbol_StdStr ," <- ",p.str(),", PrimeProduct: ", PrimeProduct_UInt64Vec.str() });
+					}
+				}
+				__stdlog__({ "" });
+				TempInnerAxiom_UInt64Vec.emplace_back(PrimeProduct_UInt64Vec);
+			}
+			TempInnerAxiom_UInt64Vec.emplace_back(++GUID_UInt64); // guid
+
+			// A directed rule is marked with the parity of the opcodes that run it (see DirectionAllowed) //
+			if (DirectedAxiom(Subnet_StdStrVec))
+				TempInnerAxiom_UInt64Vec.emplace_back(0x00);
+
+			// Rebalance: the larger composite is the axiom's LHS //
+			Axioms_UInt64Vec.emplace_back(InRebalanceFlag ? RebalancedAxiom(std::move(TempInnerAxiom_UInt64Vec)) : std::move(TempInnerAxiom_UInt64Vec));
+		}
+
+		__stdtraceout__("EncodeAxioms");
+		return Axioms_UInt64Vec;
+	}
+
+	/**
+	 * TokenDistance() : The number of tokens of LHS or RHS without a counterpart in the other side (0: the sides are
+	 * permutations of one another), the distance the anytime search reports for a partial proof.
+	 * usage: TokenDistance({ { "1", "+", "1" }, { "2" } }); // returns 4
+	*/
+	std::size_t TokenDistance(const std::vector<std::vector<std::string>>& InTheoremStdStrVec)
+	{
+		std::unordered_map<std::string, std::ptrdiff_t> Balance;
+		for (const std::string& Symbol_StdStr : InTheoremStdStrVec[0])
+			++Balance[Symbol_StdStr];
+		for (const std::string& Symbol_StdStr : InTheoremStdStrVec[1])
+			--Balance[Symbol_StdStr];
+
+		std::size_t Distance_UInt64{};
+		for (const auto& [Symbol_StdStr, Count] : Balance)
+			Distance_UInt64 += static_cast<std::size_t>(Count < 0 ? -Count : Count);
+		return Distance_UInt64;
+	}
+
+	/**
+	 * CompositeDistance() : TokenDistance() on the prime composites - the symbol primes left in LHS and RHS once their
+	 * greatest common divisor is divided out - for the BestFirst engine, whose nodes carry no strings.
+	 * Counting stops at InBound_UInt64, the distance to beat.
+	*/
+	std::size_t CompositeDistance
+	(
+		const BigInt128_t& InLHS,
+		const BigInt128_t& InRHS,
+		const std::vector<BigInt128_t>& InSymbolPrimes_UInt64Vec,
+		const std::size_t InBound_UInt64
+	)
+	{
+		const BigInt128_t Common = boost::multiprecision::gcd(InLHS, InRHS);
+		std::size_t Distance_UInt64{};
+		for (BigInt128_t Rest : { InLHS / Common, InRHS / Common })
+		{
+			BigInt128_t Quotient, Remainder;
+			for (auto p = InSymbolPrimes_UInt64Vec.begin(); Rest > 1 && p != InSymbolPrimes_UInt64Vec.end(); ++p)
+			{
+				// Every smaller symbol prime is divided out: a rest below p * p is a single symbol prime //
+				if (Rest < *p * *p)
+				{
+					++Distance_UInt64;
+					break;
+				}
+				for (boost::multiprecision::divide_qr(Rest, *p, Quotient, Remainder); Remainder == 0; boost::multiprecision::divide_qr(Rest, *p, Quotient, Remainder))
+				{
+					Rest = Quotient;
+					if (++Distance_UInt64 >= InBound_UInt64)
+						return Distance_UInt64;
+				}
+			}
+		}
+		return Distance_UInt64;
+	}
+
+	/**
+	 * ClosestNodeTracker : The anytime search's best node so far - the one whose LHS and RHS are closest, by TokenDistance()
+	 * (or by CompositeDistance(), over the symbol primes it is given, for nodes without strings).
+	 * Each engine offers it the nodes it reaches; when a deadline, budget or exhausted search ends __Prove__ without a proof,
+	 * the kept node's trace - as far as it replays on the strings - is returned as a partial proof, with its remaining distance.
+	*/
+	class ClosestNodeTracker
+	{
+	public:
+		ClosestNodeTracker() = default;
+
+		// The symbol primes, for the engines whose nodes carry no strings, to measure composites by //
+		explicit ClosestNodeTracker(std::vector<BigInt128_t> InSymbolPrimes_UInt64Vec) : SymbolPrimes_UInt64Vec(std::move(InSymbolPrimes_UInt64Vec))
+		{
+		}
+
+		// Keep InTheoremRef if it is strictly closer than the node kept so far //
+		bool Offer(const std::vector<BigInt128_t>& InTheoremRef, const std::size_t InDistance_UInt64)
+		{
+			if (InDistance_UInt64 >= Distance_UInt64)
+				return false;
+			Theorem_UInt64Vec = InTheoremRef;
+			Distance_UInt64 = InDistance_UInt64;
+			return true;
+		}
+
+		// The distance to beat (max: no node kept yet) //
+		std::size_t Distance() const noexcept
+		{
+			return Distance_UInt64;
+		}
+
+		// CompositeDistance() between InLHS and InRHS, counted up to the distance to beat //
+		std::size_t Distance(const BigInt128_t& InLHS, const BigInt128_t& InRHS) const
+		{
+			return CompositeDistance(InLHS, InRHS, SymbolPrimes_UInt64Vec, Distance_UInt64);
+		}
+
+		bool empty() const noexcept
+		{
+			return Theorem_UInt64Vec.empty();
+		}
+
+		const std::vector<BigInt128_t>& Theorem() const noexcept
+		{
+			return Theorem_UInt64Vec;
+		}
+
+	private:
+		std::vector<BigInt128_t> SymbolPrimes_UInt64Vec;
+		std::vector<BigInt128_t> Theorem_UInt64Vec;
+		std::size_t Distance_UInt64{ std::numeric_limits<std::size_t>::max() };
+	};
+
+	/**
+	 * DeadlineWatchdog : Enforces ProofSearchOptions_Struct::TimeBudgetMilliseconds_UInt64 for the engines, which poll an abort flag.
+	 * With a budget, a thread raises AbortFlag once the budget has passed since InStart; without one, it is never raised.
+	 * Stop() (or the destructor) ends the watch once the engine returns.
+	*/
+	class DeadlineWatchdog
+	{
+	public:
+		explicit DeadlineWatchdog(const std::uint64_t InBudgetMilliseconds_UInt64, const std::chrono::steady_clock::time_point InStart = std::chrono::steady_clock::now())
+		{
+			if (!InBudgetMilliseconds_UInt64)
+				return;
+
+			const std::chrono::steady_clock::time_point Deadline = InStart + std::chrono::milliseconds(InBudgetMilliseconds_UInt64);
+			Watch = std::async
+			(
+				std::launch::async,
+				[this, Deadline]( ) -> void
+				{
+					while (!DoneFlag && std::chrono::steady_clock::now() < Deadline)
+						std::this_thread::sleep_for(std::chrono::milliseconds(1));
+					AbortFlag = true;
+				}
+			);
+		}
+
+		DeadlineWatchdog(const DeadlineWatchdog&) = delete;
+		DeadlineWatchdog& operator=(const DeadlineWatchdog&) = delete;
+
+		~DeadlineWatchdog()
+		{
+			Stop();
+		}
+
+		void Stop()
+		{
+			DoneFlag = true;
+			if (Watch.valid())
+				Watch.get();
+		}
+
+		std::atomic<bool> AbortFlag{};
+
+	private:
+		std::atomic<bool> DoneFlag{};
+		std::future<void> Watch;
+	};
+
+	/**
+	 * __ProveBidirectional__ : Meet-in-the-middle search over prime composites, with separate LHS-side and
+	 * RHS-side frontiers. Each round expands one whole breadth-first layer of the smaller frontier, and every
+	 * generated state is probed against the other side's visited map, so a meeting is seen as soon as it exists.
+	 * Each visited state keeps its packed trace (one varint (guid << 2 | opcode) per step, as PackProofTrace);
+	 * a proof is the LHS trace followed by the RHS trace, handed to InOnMeetRef as a theorem node whose guid slot
+	 * is the goal-set target met. InOnMeetRef returns true to stop; the search otherwise continues until one side
+	 * is exhausted (no proof exists), InOptionsRef.StateLimit_UInt64 is reached, or InAbortFlagRef is raised.
+	 * A directed rule only runs one way, so with any in the library a side is only exhausted once both are.
+	 * With InOutClosestPtr, each state expanded is paired with the other side's state in the closest pair so far (or its roots),
+	 * and the closer pairs are offered as theorem nodes (LHS-side state and trace, RHS-side state and trace).
+	 * InAxiomsRef must be encoded as written (EncodeAxioms(..., false)), since the opcodes are replayed by ProofVerified.
+	*/
+	bool __ProveBidirectional__
+	(
+		const
+		BigInt128_t&
+		InLHS_UInt64,
+
+		const
+		std::vector<
+		BigInt128_t>&
+		InTargets_UInt64Vec,
+
+		const
+		std::vector<
+		std::vector<
+		BigInt128_t>>&
+		InAxiomsRef,
+
+		const
+		std::function<
+		bool(const std::vector<BigInt128_t>&)>&
+		InOnMeetRef,
+
+		const
+		ProofSearchOptions_Struct&
+		InOptionsRef,
+
+		const
+		std::atomic<bool>&
+		InAbortFlagRef,
+
+		// Offered the closest pair of LHS-side and RHS-side states seen, for a partial proof (nullptr: not tracked) //
+		ClosestNodeTracker*
+		InOutClosestPtr = nullptr
+	)
+	{
+		__stdtracein__("__ProveBidirectional__");
+
+		constexpr int LHS = 0;
+		constexpr int RHS = 1;
+		constexpr int guid_UInt64 = 2;
+
+		struct Visit_Struct
+		{
+			std::size_t Target_UInt64{};
+			std::string PackedTraceStdStr;
+		};
+
+		struct Side_Struct
+		{
+			std::size_t OpcodeBase_UInt64{};
+			std::unordered_map<BigInt128_t, Visit_Struct> Visited;
+			std::vector<BigInt128_t> Frontier;
+		};
+
+		Side_Struct Sides[2]{ { 0x00, {}, {} }, { 0x02, {}, {} } };
+
+		Sides[LHS].Visited.emplace(InLHS_UInt64, Visit_Struct{});
+		Sides[LHS].Frontier.emplace_back(InLHS_UInt64);
+		for (std::size_t k = 0; k < InTargets_UInt64Vec.size(); ++k)
+		{
+			if (Sides[RHS].Visited.emplace(InTargets_UInt64Vec[k], Visit_Struct{ k, {} }).second)
+				Sides[RHS].Frontier.emplace_back(InTargets_UInt64Vec[k]);
+		}
+
+		// Join an LHS-side trace and an RHS-side trace into a theorem node //
+		auto Joined = [&](const BigInt128_t& InLHS_UInt64, const Visit_Struct& InLHSVisitRef, const BigInt128_t& InRHS_UInt64, const Visit_Struct& InRHSVisitRef) -> std::vector<BigInt128_t>
+		{
+			std::vector<BigInt128_t> Theorem{ InLHS_UInt64, InRHS_UInt64, InRHSVisitRef.Target_UInt64, 0 };
+			for (const std::string* Packed_StdStr : { &InLHSVisitRef.PackedTraceStdStr, &InRHSVisitRef.PackedTraceStdStr })
+			{
+				for (std::size_t Offset_UInt64{}; Offset_UInt64 < Packed_StdStr->size(); )
+				{
+					const std::uint64_t Step_UInt64 = UnpackVarUInt64(*Packed_StdStr, Offset_UInt64);
+					Theorem.emplace_back(Step_UInt64 & 0x03);
+					Theorem.emplace_back(Step_UInt64 >> 2);
+				}
+			}
+			return Theorem;
+		};
+
+		// Join the two traces at a state seen by both sides //
+		auto Meet = [&](const BigInt128_t& InState_UInt64, const Visit_Struct& InLHSVisitRef, const Visit_Struct& InRHSVisitRef) -> bool
+		{
+			return InOnMeetRef(Joined(InState_UInt64, InLHSVisitRef, InState_UInt64, InRHSVisitRef));
+		};
+
+		// Pair a state expanded with the other side's state of the closest pair so far - its roots, until there is one //
+		auto OfferClosest = [&](const Side_Struct& InSideRef, const BigInt128_t& InState_UInt64, const Visit_Struct& InVisitRef) -> void
+		{
+			const bool bLHSSideFlag = &InSideRef == &Sides[LHS];
+			const Side_Struct& Other = bLHSSideFlag ? Sides[RHS] : Sides[LHS];
+			const std::vector<BigInt128_t> Partners_UInt64Vec
+			{
+				!InOutClosestPtr->empty() ? std::vector<BigInt128_t>{ InOutClosestPtr->Theorem()[bLHSSideFlag ? RHS : LHS] } :
+				bLHSSideFlag ? InTargets_UInt64Vec : std::vector<BigInt128_t>{ InLHS_UInt64 }
+			};
+
+			for (const BigInt128_t& Partner_UInt64 : Partners_UInt64Vec)
+			{
+				const std::size_t Distance_UInt64 = bLHSSideFlag ? InOutClosestPtr->Distance(InState_UInt64, Partner_UInt64) : InOutClosestPtr->Distance(Partner_UInt64, InState_UInt64);
+				if (Distance_UInt64 >= InOutClosestPtr->Distance())
+					continue;
+				const auto it = Other.Visited.find(Partner_UInt64);
+				if (it != Other.Visited.end())
+					InOutClosestPtr->Offer(bLHSSideFlag ? Joined(InState_UInt64, InVisitRef, Partner_UInt64, it->second) : Joined(Partner_UInt64, it->second, InState_UInt64, InVisitRef), Distance_UInt64);
+			}
+		};
+
+		bool QED{};
+
+		if (const auto it = Sides[RHS].Visited.find(InLHS_UInt64); it != Sides[RHS].Visited.end())
+			QED = Meet(InLHS_UInt64, Sides[LHS].Visited[InLHS_UInt64], it->second);
+
+		// Without directed rules every move is reversible: one side exhausted has seen the theorem's whole class //
+		const bool bDirectedFlag = std::any_of(InAxiomsRef.begin(), InAxiomsRef.end(), [](const std::vector<BigInt128_t>& InAxiomRef) { return InAxiomRef.size() > 3; });
+		auto Exhausted = [&]() -> bool
+		{
+			return bDirectedFlag ? Sides[LHS].Frontier.empty() && Sides[RHS].Frontier.empty() : Sides[LHS].Frontier.empty() || Sides[RHS].Frontier.empty();
+		};
+
+		while (!QED && !InAbortFlagRef && !Exhausted())
+		{
+			Side_Struct& Side = !Sides[LHS].Frontier.empty() && ( Sides[RHS].Frontier.empty() || Sides[LHS].Frontier.size() <= Sides[RHS].Frontier.size() ) ? Sides[LHS] : Sides[RHS];
+			Side_Struct& Other = &Side == &Sides[LHS] ? Sides[RHS] : Sides[LHS];
+
+			std::vector<BigInt128_t> NextFrontier;
+			for (const BigInt128_t& State_UInt64 : Side.Frontier)
+			{
+				const Visit_Struct Visit{ Side.Visited[State_UInt64] };
+				if (InOutClosestPtr)
+					OfferClosest(Side, State_UInt64, Visit);
+				for (const std::vector<BigInt128_t>& Axiom : InAxiomsRef)
+				{
+					// reduce (+0) rewrites the axiom's LHS to its RHS, expand (+1) its RHS to its LHS //
+					for (const std::size_t Direction_UInt64 : { std::size_t{ 0 }, std::size_t{ 1 } })
+					{
+						if (!DirectionAllowed(Axiom, Direction_UInt64) || State_UInt64 % Axiom[Direction_UInt64] != 0)
+							continue;
+						const BigInt128_t& From = Axiom[Direction_UInt64];
+
+						BigInt128_t Next_UInt64 = State_UInt64 / From * Axiom[Direction_UInt64 ^ 1];
+						if (Side.Visited.find(Next_UInt64) != Side.Visited.end())
+							continue;
+
+						Visit_Struct NextVisit{ Visit };
+						PackVarUInt64(NextVisit.PackedTraceStdStr, ( static_cast<std::uint64_t>(Axiom[guid_UInt64]) << 2 ) | ( Side.OpcodeBase_UInt64 + Direction_UInt64 ));
+
+						if (const auto it = Other.Visited.find(Next_UInt64); it != Other.Visited.end())
+						{
+							QED = &Side == &Sides[LHS] ? Meet(Next_UInt64, NextVisit, it->second) : Meet(Next_UInt64, it->second, NextVisit);
+							if (QED)
+								break;
+						}
+
+						Side.Visited.emplace(Next_UInt64, std::move(NextVisit));
+						NextFrontier.emplace_back(std::move(Next_UInt64));
+					}
+					if (QED)
+						break;
+				}
+				if (QED || InAbortFlagRef)
+					break;
+				if (InOptionsRef.StateLimit_UInt64 && Sides[LHS].Visited.size() + Sides[RHS].Visited.size() >= InOptionsRef.StateLimit_UInt64)
+				{
+					__stdlog__({ "__ProveBidirectional__: StateLimit_UInt64 reached" });
+					NextFrontier.clear();
+					break;
+				}
+			}
+			Side.Frontier = std::move(NextFrontier);
+		}
+
+		__stdtraceout__("__ProveBidirectional__");
+		return QED;
+	}
+
+	/**
+	 * AxiomLattice : The integer lattice spanned by an axiom library's difference vectors, in Hermite normal form.
+	 * Each axiom, read as exponent vectors over the symbol primes (token counts), contributes RHS - LHS; every rewrite
+	 * adds or subtracts one of these to a side, so LHS - RHS stays in its root's coset of the lattice. A theorem whose
+	 * LHS - RHS is not in the lattice is therefore unprovable - and so is every node of its search, so an impossible
+	 * goal-set target is dropped with its whole subtree. Membership is a reduction against the basis, in microseconds.
+	 * usage: if (!AxiomLatticeOf(AxiomSetVersion_UInt64, AxiomsStdStrVec)->Contains(LHSStdStrVec, RHSStdStrVec)) { // unprovable // }
+	*/
+	class AxiomLattice
+	{
+	public:
+		explicit AxiomLattice
+		(
+			const
+			std::vector<
+			std::vector<
+			std::vector<
+			std::string>>>&
+			InAxiomsStdStrVec
+		)
+		{
+			__stdtracein__("AxiomLattice");
+
+			// Rarest symbols lead: a symbol shared by many axioms (an operator) as a leading column would chain every insertion through its row //
+			std::unordered_map<std::string, std::size_t> Axioms_UInt64Map;
+			std::vector<std::string> SymbolsStdStrVec;
+			for (const std::vector<std::vector<std::string>>& Subnet_StdStrVec : InAxiomsStdStrVec)
+			{
+				if (Subnet_StdStrVec.size() < 2)
+					continue;
+				std::unordered_set<std::string> Symbols(Subnet_StdStrVec[0].begin(), Subnet_StdStrVec[0].end());
+				Symbols.insert(Subnet_StdStrVec[1].begin(), Subnet_StdStrVec[1].end());
+				for (const std::string& Symbol_StdStr : Symbols)
+					if (Axioms_UInt64Map[Symbol_StdStr]++ == 0)
+						SymbolsStdStrVec.emplace_back(Symbol_StdStr);
+			}
+			std::stable_sort(SymbolsStdStrVec.begin(), SymbolsStdStrVec.end(), [&](const std::string& a, const std::string& b) { return Axioms_UInt64Map[a] < Axioms_UInt64Map[b]; });
+			for (const std::string& Symbol_StdStr : SymbolsStdStrVec)
+				Column_UInt64Map.emplace(Symbol_StdStr, Column_UInt64Map.size());
+
+			for (const std::vector<std::vector<std::string>>& Subnet_StdStrVec : InAxiomsStdStrVec)
+			{
+				if (Subnet_StdStrVec.size() < 2)
+					continue;
+				SparseVector Difference;
+				CountDifference(Subnet_StdStrVec[1], Subnet_StdStrVec[0], Difference);
+				Insert(std::move(Difference));
+			}
+
+			// Hermite normal form: entries above each pivot reduced into [0, pivot), rows below first, so each reducing row is final //
+			for (auto Basis_it = Basis.rbegin(); Basis_it != Basis.rend(); ++Basis_it)
+			{
+				SparseVector& Row = Basis_it->second;
+				std::size_t Column_UInt64 = Basis_it->first;
+				for (auto it = Row.upper_bound(Column_UInt64); it != Row.end(); it = Row.upper_bound(Column_UInt64))
+				{
+					Column_UInt64 = it->first;
+					const auto Lower_it = Basis.find(Column_UInt64);
+					if (Lower_it == Basis.end())
+						continue;
+					const BigInt128_t& Pivot = Lower_it->second.at(Column_UInt64);
+					BigInt128_t Quotient = it->second / Pivot;
+					if (it->second - Quotient * Pivot < 0)
+						--Quotient;
+					Subtract(Row, Quotient, Lower_it->second);
+				}
+			}
+
+			__stdlog__({ "AxiomLattice: rank ", std::to_string(Basis.size()), " over ", std::to_string(Column_UInt64Map.size()), " symbols" });
+			__stdtraceout__("AxiomLattice");
+		}
+
+		// True when LHS - RHS lies in the lattice: the necessary condition for a proof of LHS = RHS //
+		bool Contains
+		(
+			const
+			std::vector<
+			std::string>&
+			InLHSStdStrVec,
+
+			const
+			std::vector<
+			std::string>&
+			InRHSStdStrVec
+		) const
+		{
+			SparseVector Target;
+			if (!CountDifference(InLHSStdStrVec, InRHSStdStrVec, Target))
+				return false; // A symbol no axiom mentions, left unbalanced //
+			while (!Target.empty())
+			{
+				const auto& [Column_UInt64, Value] = *Target.begin();
+				const auto it = Basis.find(Column_UInt64);
+				if (it == Basis.end() || Value % it->second.at(Column_UInt64) != 0)
+					return false;
+				Subtract(Target, Value / it->second.at(Column_UInt64), it->second);
+			}
+			return true;
+		}
+
+		std::size_t Rank() const
+		{
+			return Basis.size();
+		}
+
+	private:
+		// Column -> non-zero entry //
+		using SparseVector = std::map<std::size_t, BigInt128_t>;
+
+		// OutVectorRef = counts(InPlus) - counts(InMinus); false if a symbol outside the columns is left non-zero //
+		bool CountDifference
+		(
+			const std::vector<std::string>& InPlusStdStrVec,
+			const std::vector<std::string>& InMinusStdStrVec,
+			SparseVector& OutVectorRef
+		) const
+		{
+			std::unordered_map<std::string, long long> Unknown;
+			auto Count = [&](const std::vector<std::string>& InSubnetStdStrVec, const int InSign) -> void
+			{
+				for (const std::string& Symbol_StdStr : InSubnetStdStrVec)
+				{
+					const auto it = Column_UInt64Map.find(Symbol_StdStr);
+					if (it == Column_UInt64Map.end())
+					{
+						Unknown[Symbol_StdStr] += InSign;
+						continue;
+					}
+					if (( OutVectorRef[it->second] += InSign ) == 0)
+						OutVectorRef.erase(it->second);
+				}
+			};
+			Count(InPlusStdStrVec, 1);
+			Count(InMinusStdStrVec, -1);
+			return std::all_of(Unknown.begin(), Unknown.end(), [](const auto& InCountRef) { return InCountRef.second == 0; });
+		}
+
+		// InOutVectorRef -= InFactor * InRowRef //
+		static void Subtract(SparseVector& InOutVectorRef, const BigInt128_t& InFactor, const SparseVector& InRowRef)
+		{
+			if (InFactor == 0)
+				return;
+			for (const auto& [Column_UInt64, Value] : InRowRef)
+				if (( InOutVectorRef[Column_UInt64] -= InFactor * Value ) == 0)
+					InOutVectorRef.erase(Column_UInt64);
+		}
+
+		// Echelon insertion: a shared leading column is merged by an extended-gcd (unimodular) step, so the span is kept //
+		void Insert(SparseVector InVector)
+		{
+			while (!InVector.empty())
+			{
+				const std::size_t Column_UInt64 = InVector.begin()->first;
+				const BigInt128_t a = InVector.begin()->second;
+				const auto it = Basis.find(Column_UInt64);
+				if (it == Basis.end())
+				{
+					if (a < 0)
+						for (auto& [Column, Value] : InVector)
+							Value = -Value;
+					Basis.emplace(Column_UInt64, std::move(InVector));
+					return;
+				}
+
+				SparseVector& Row = it->second;
+				const BigInt128_t b = Row.at(Column_UInt64);
+				if (a % b == 0)
+				{
+					Subtract(InVector, a / b, Row);
+					continue;
+				}
+
+				// s * b + t * a = g: Row <- s * Row + t * InVector (pivot g), InVector <- (b / g) * InVector - (a / g) * Row //
+				BigInt128_t s0{ 1 }, s1{ 0 }, t0{ 0 }, t1{ 1 }, r0{ b }, r1{ a };
+				while (r1 != 0)
+				{
+					const BigInt128_t q = r0 / r1;
+					BigInt128_t r2 = r0 - q * r1, s2 = s0 - q * s1, t2 = t0 - q * t1;
+					r0 = std::move(r1), r1 = std::move(r2);
+					s0 = std::move(s1), s1 = std::move(s2);
+					t0 = std::move(t1), t1 = std::move(t2);
+				}
+				if (r0 < 0)
+				{
+					r0 = -r0;
+					s0 = -s0;
+					t0 = -t0;
+				}
+
+				SparseVector Merged, Residual;
+				for (const auto& [Column, Value] : Row)
+				{
+					Merged[Column] += s0 * Value;
+					Residual[Column] -= ( a / r0 ) * Value;
+				}
+				for (const auto& [Column, Value] : InVector)
+				{
+					Merged[Column] += t0 * Value;
+					Residual[Column] += ( b / r0 ) * Value;
+				}
+				std::erase_if(Merged, [](const auto& InEntryRef) { return InEntryRef.second == 0; });
+				std::erase_if(Residual, [](const auto& InEntryRef) { return InEntryRef.second == 0; });
+				Row = std::move(Merged);
+				InVector = std::move(Residual);
+			}
+		}
+
+		std::unordered_map<std::string, std::size_t> Column_UInt64Map;
+
+		// Leading column -> row; each row's leading entry (its pivot) is positive //
+		std::map<std::size_t, SparseVector> Basis;
+	};
+
+	/**
+	 * SharedObjectCache : In-process LRU cache of immutable objects built from an axiom library, shared by every EuclidProver
+	 * instance and keyed by a hash of what they were built from. A miss builds the object through InBuildRef, under the lock,
+	 * so it is built once. At most InCapacity_UInt64 entries are held, evicting the least recently used first; an evicted
+	 * object lives on for as long as a prover holds it.
+	*/
+	template <typename T>
+	class SharedObjectCache
+	{
+	public:
+		explicit SharedObjectCache(const std::size_t InCapacity_UInt64) noexcept :
+			Capacity_UInt64{ InCapacity_UInt64 }
+		{
+
+		}
+
+		std::shared_ptr<const T> FindOrBuild(const std::uint64_t InKey_UInt64, const std::function<std::shared_ptr<const T>()>& InBuildRef)
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			if (const auto it = Index.find(InKey_UInt64); it != Index.end())
+			{
+				Entries.splice(Entries.begin(), Entries, it->second);
+				return it->second->second;
+			}
+
+			Entries.emplace_front(InKey_UInt64, InBuildRef());
+			Index.emplace(InKey_UInt64, Entries.begin());
+			while (Entries.size() > Capacity_UInt64)
+			{
+				Index.erase(Entries.back().first);
+				Entries.pop_back();
+			}
+			return Entries.front().second;
+		}
+
+	private:
+		using Entry_t = std::pair<std::uint64_t, std::shared_ptr<const T>>;
+
+		std::mutex Mutex;
+		std::size_t Capacity_UInt64;
+		std::list<Entry_t> Entries;
+		std::unordered_map<std::uint64_t, typename std::list<Entry_t>::iterator> Index;
+	};
+
+	/**
+	 * AxiomLatticeOf() : The AxiomLattice of an axiom library, built once per axiom-set version and shared thereafter,
+	 * for the few versions used most recently.
+	*/
+	std::shared_ptr<const AxiomLattice> AxiomLatticeOf
+	(
+		const
+		std::uint64_t
+		InAxiomSetVersion_UInt64,
+
+		const
+		std::vector<
+		std::vector<
+		std::vector<
+		std::string>>>&
+		InAxiomsStdStrVec
+	)
+	{
+		// A prover that edits its library moves to a new version each time: the old ones are evicted, not kept for good //
+		static SharedObjectCache<AxiomLattice> Lattices{ 8 };
+		return Lattices.FindOrBuild(InAxiomSetVersion_UInt64, [&]( ) { return std::make_shared<const AxiomLattice>(InAxiomsStdStrVec); });
+	}
+
+	/**
+	 * SliceAxioms() : The axioms a proof of InTheoremStdStrVec can use, as ascending indices into InAxiomsStdStrVec.
+	 * A bipartite closure over symbols and axiom sides: a side is enabled once every symbol on it is reachable (the
+	 * theorem's symbols are), and an enabled side makes its axiom usable and the other side's symbols reachable. Every
+	 * state of a search holds reachable symbols only, so an axiom with neither side enabled can never be applied.
+	 * usage: const std::vector<std::size_t> Kept_UInt64Vec = SliceAxioms(TheoremStdStrVec, AxiomsStdStrVec);
+	*/
+	std::vector<std::size_t> SliceAxioms
+	(
+		const
+		std::vector<
+		std::vector<
+		std::string>>&
+		InTheoremStdStrVec,
+
+		const
+		std::vector<
+		std::vector<
+		std::vector<
+		std::string>>>&
+		InAxiomsStdStrVec
+	)
+	{
+		__stdtracein__("SliceAxioms");
+
+		constexpr int LHS = 0;
+		constexpr int RHS = 1;
+
+		// Each axiom side's symbols not yet reachable; each symbol's waiting sides (axiom * 2 + side) //
+		std::unordered_map<std::string, std::vector<std::size_t>> Watchers;
+		std::vector<std::array<std::size_t, 2>> Missing(InAxiomsStdStrVec.size());
+		std::unordered_set<std::string> Reachable;
+		for (const std::vector<std::string>& Subnet_StdStrVec : InTheoremStdStrVec)
+			Reachable.insert(Subnet_StdStrVec.begin(), Subnet_StdStrVec.end());
+
+		std::vector<bool> KeptFlagVec(InAxiomsStdStrVec.size());
+		std::vector<std::size_t> Enabled_UInt64Vec;
+		for (std::size_t a = 0; a < InAxiomsStdStrVec.size(); ++a)
+		{
+			if (InAxiomsStdStrVec[a].size() < 2)
+				continue;
+			for (const int i : { LHS, RHS })
+			{
+				for (const std::string& Symbol_StdStr : std::unordered_set<std::string>(InAxiomsStdStrVec[a][i].begin(), InAxiomsStdStrVec[a][i].end()))
+				{
+					if (Reachable.contains(Symbol_StdStr))
+						continue;
+					Watchers[Symbol_StdStr].emplace_back(a * 2 + i);
+					++Missing[a][i];
+				}
+				if (!Missing[a][i])
+					Enabled_UInt64Vec.emplace_back(a * 2 + i);
+			}
+		}
+
+		while (!Enabled_UInt64Vec.empty())
+		{
+			const std::size_t Side_UInt64 = Enabled_UInt64Vec.back();
+			Enabled_UInt64Vec.pop_back();
+			KeptFlagVec[Side_UInt64 / 2] = true;
+			for (const std::string& Symbol_StdStr : InAxiomsStdStrVec[Side_UInt64 / 2][Side_UInt64 % 2 == LHS ? RHS : LHS])
+			{
+				if (!Reachable.insert(Symbol_StdStr).second)
+					continue;
+				const auto it = Watchers.find(Symbol_StdStr);
+				if (it == Watchers.end())
+					continue;
+				for (const std::size_t Waiting_UInt64 : it->second)
+					if (--Missing[Waiting_UInt64 / 2][Waiting_UInt64 % 2] == 0)
+						Enabled_UInt64Vec.emplace_back(Waiting_UInt64);
+			}
+		}
+
+		std::vector<std::size_t> Kept_UInt64Vec;
+		for (std::size_t a = 0; a < KeptFlagVec.size(); ++a)
+			if (KeptFlagVec[a])
+				Kept_UInt64Vec.emplace_back(a);
+
+		__stdlog__({ "SliceAxioms: ", std::to_string(InAxiomsStdStrVec.size() - Kept_UInt64Vec.size()), " of ", std::to_string(InAxiomsStdStrVec.size()), " axioms sliced away" });
+		__stdtraceout__("SliceAxioms");
+		return Kept_UInt64Vec;
+	}
+
+	/**
+	 * AxiomRewriteGraph : The axiom dependency graph, and its strongly connected components, computed once per axiom library.
+	 * Axiom i calls axiom j (i != j) when a side of j occurs within a side of i - rewriting with i into that side makes
+	 * room for j - the relation processAxioms records in each axiom's call graph. Sides are compared as token multisets,
+	 * through an index on each side's rarest symbol. An SCC of two or more axioms is a cyclic cluster: rewrites within it
+	 * can keep enabling one another (as an "IsIn" operator linking categories does), and so can grow a search without bound.
+	 * Insert() and Erase() keep the graph current as single axioms come and go, touching only the sides that share a symbol
+	 * with the axiom; the SCCs are then re-analysed on the next query of them.
+	 * usage: const AxiomRewriteGraph Graph(AxiomsStdStrVec); for (const std::vector<std::size_t>& Cluster : Graph.CyclicClusters()) { ... }
+	*/
+	class AxiomRewriteGraph
+	{
+	public:
+		AxiomRewriteGraph() = default;
+
+		explicit AxiomRewriteGraph
+		(
+			const
+			std::vector<
+			std::vector<
+			std::vector<
+			std::string>>>&
+			InAxiomsStdStrVec
+		) :
+			Calls_UInt64Vec(InAxiomsStdStrVec.size()),
+			Sides(InAxiomsStdStrVec.size() * 2)
+		{
+			__stdtracein__("AxiomRewriteGraph");
+
+			for (std::size_t a = 0; a < InAxiomsStdStrVec.size(); ++a)
+				IndexSides(a, InAxiomsStdStrVec[a]);
+
+			// Candidates for containing side j are the sides holding its rarest symbol; empty sides call nothing //
+			for (std::size_t j = 0; j < Sides.size(); ++j)
+				for (const std::size_t i : Containing(j))
+					Calls_UInt64Vec[i / 2].emplace_back(j / 2);
+			for (std::vector<std::size_t>& Calls : Calls_UInt64Vec)
+			{
+				std::sort(Calls.begin(), Calls.end());
+				Calls.erase(std::unique(Calls.begin(), Calls.end()), Calls.end());
+			}
+
+			Analyse();
+			__stdtraceout__("AxiomRewriteGraph");
+		}
+
+		/**
+		 * Insert() : Add axiom InAxiom_UInt64 (a slot past the end, or one emptied by Erase), with its calls both ways.
+		 * Its callees are found among the sides sharing a symbol with its own, its callers among those holding its sides'
+		 * rarest symbols, so the cost is that of the axioms it touches, not the library's.
+		*/
+		void Insert
+		(
+			const std::size_t InAxiom_UInt64,
+
+			const
+			std::vector<
+			std::vector<
+			std::string>>&
+			InAxiomStdStrVec
+		)
+		{
+			if (InAxiom_UInt64 >= Calls_UInt64Vec.size())
+			{
+				Calls_UInt64Vec.resize(InAxiom_UInt64 + 1);
+				Sides.resize(Calls_UInt64Vec.size() * 2);
+			}
+			Erase(InAxiom_UInt64);
+			IndexSides(InAxiom_UInt64, InAxiomStdStrVec);
+
+			std::vector<std::size_t>& Calls = Calls_UInt64Vec[InAxiom_UInt64];
+			for (const std::size_t i : { InAxiom_UInt64 * 2, InAxiom_UInt64 * 2 + 1 })
+			{
+				for (const auto& [Symbol_UInt64, Count_UInt64] : Sides[i])
+					for (const std::size_t j : Postings[Symbol_UInt64])
+						if (j / 2 != InAxiom_UInt64 && Contains(i, j))
+							Calls.emplace_back(j / 2);
+				for (const std::size_t Caller_UInt64 : Containing(i))
+				{
+					std::vector<std::size_t>& CallerCalls = Calls_UInt64Vec[Caller_UInt64 / 2];
+					const auto it = std::lower_bound(CallerCalls.begin(), CallerCalls.end(), InAxiom_UInt64);
+					if (it == CallerCalls.end() || *it != InAxiom_UInt64)
+						CallerCalls.insert(it, InAxiom_UInt64);
+				}
+			}
+			std::sort(Calls.begin(), Calls.end());
+			Calls.erase(std::unique(Calls.begin(), Calls.end()), Calls.end());
+			bAnalysedFlag = false;
+		}
+
+		// Erase() : Empty axiom InAxiom_UInt64's slot (axioms keep their indices), dropping its calls both ways //
+		void Erase(const std::size_t InAxiom_UInt64)
+		{
+			if (InAxiom_UInt64 >= Calls_UInt64Vec.size())
+				return;
+
+			for (const std::size_t i : { InAxiom_UInt64 * 2, InAxiom_UInt64 * 2 + 1 })
+			{
+				for (const std::size_t Caller_UInt64 : Containing(i))
+				{
+					std::vector<std::size_t>& CallerCalls = Calls_UInt64Vec[Caller_UInt64 / 2];
+					const auto it = std::lower_bound(CallerCalls.begin(), CallerCalls.end(), InAxiom_UInt64);
+					if (it != CallerCalls.end() && *it == InAxiom_UInt64)
+						CallerCalls.erase(it);
+				}
+				for (const auto& [Symbol_UInt64, Count_UInt64] : Sides[i])
+					std::erase(Postings[Symbol_UInt64], i);
+				Sides[i].clear();
+			}
+			Calls_UInt64Vec[InAxiom_UInt64].clear();
+			bAnalysedFlag = false;
+		}
+
+		// The axioms axiom InAxiom_UInt64 calls (0-based, ascending) //
+		const std::vector<std::size_t>& Calls(const std::size_t InAxiom_UInt64) const
+		{
+			return Calls_UInt64Vec[InAxiom_UInt64];
+		}
+
+		// The SCC of an axiom; SCCs are numbered in reverse topological order (an axiom's calls lie in its SCC or a lower one) //
+		std::size_t Component(const std::size_t InAxiom_UInt64) const
+		{
+			Analyse();
+			return Component_UInt64Vec[InAxiom_UInt64];
+		}
+
+		// SCCs of two or more axioms (0-based, ascending) //
+		const std::vector<std::vector<std::size_t>>& CyclicClusters() const
+		{
+			Analyse();
+			return Clusters_UInt64Vec;
+		}
+
+		bool InCycle(const std::size_t InAxiom_UInt64) const
+		{
+			Analyse();
+			return CyclicFlagVec[InAxiom_UInt64];
+		}
+
+	private:
+		// Record each side of axiom InAxiom_UInt64 (axiom * 2 + side) as sorted (symbol, count) pairs, in its symbols' postings //
+		void IndexSides
+		(
+			const std::size_t InAxiom_UInt64,
+
+			const
+			std::vector<
+			std::vector<
+			std::string>>&
+			InAxiomStdStrVec
+		)
+		{
+			for (std::size_t i = 0; i < 2 && i < InAxiomStdStrVec.size(); ++i)
+			{
+				std::map<std::size_t, std::size_t> Counts;
+				for (const std::string& Symbol_StdStr : InAxiomStdStrVec[i])
+					++Counts[Symbol_UInt64Map.try_emplace(Symbol_StdStr, Symbol_UInt64Map.size()).first->second];
+				Sides[InAxiom_UInt64 * 2 + i].assign(Counts.begin(), Counts.end());
+				Postings.resize(Symbol_UInt64Map.size());
+				for (const auto& [Symbol_UInt64, Count_UInt64] : Sides[InAxiom_UInt64 * 2 + i])
+					Postings[Symbol_UInt64].emplace_back(InAxiom_UInt64 * 2 + i);
+			}
+		}
+
+		bool Contains(const std::size_t InOuter_UInt64, const std::size_t InInner_UInt64) const
+		{
+			auto it = Sides[InOuter_UInt64].begin();
+			for (const auto& [Symbol_UInt64, Count_UInt64] : Sides[InInner_UInt64])
+			{
+				it = std::lower_bound(it, Sides[InOuter_UInt64].end(), std::make_pair(Symbol_UInt64, std::size_t{ 0 }));
+				if (it == Sides[InOuter_UInt64].end() || it->first != Symbol_UInt64 || it->second < Count_UInt64)
+					return false;
+			}
+			return true;
+		}
+
+		// The sides of other axioms containing side InSide_UInt64, drawn from the postings of its rarest symbol //
+		std::vector<std::size_t> Containing(const std::size_t InSide_UInt64) const
+		{
+			std::vector<std::size_t> Containing_UInt64Vec;
+			if (Sides[InSide_UInt64].empty())
+				return Containing_UInt64Vec;
+			const auto Rarest = std::min_element(Sides[InSide_UInt64].begin(), Sides[InSide_UInt64].end(), [&](const auto& a, const auto& b) { return Postings[a.first].size() < Postings[b.first].size(); });
+			for (const std::size_t i : Postings[Rarest->first])
+				if (i / 2 != InSide_UInt64 / 2 && Contains(i, InSide_UInt64))
+					Containing_UInt64Vec.emplace_back(i);
+			return Containing_UInt64Vec;
+		}
+
+		void Analyse() const
+		{
+			if (bAnalysedFlag)
+				return;
+			bAnalysedFlag = true;
+
+			const std::size_t Axioms_UInt64 = Calls_UInt64Vec.size();
+			Component_UInt64Vec.assign(Axioms_UInt64, 0);
+			CyclicFlagVec.assign(Axioms_UInt64, false);
+			Clusters_UInt64Vec.clear();
+
+			// Tarjan's SCC, iteratively (a library's call chains can be deeper than the stack) //
+			constexpr std::size_t Unvisited = std::numeric_limits<std::size_t>::max();
+			std::vector<std::size_t> Index_UInt64Vec(Axioms_UInt64, Unvisited), LowLink_UInt64Vec(Axioms_UInt64);
+			std::vector<bool> OnStackFlagVec(Axioms_UInt64);
+			std::vector<std::size_t> Stack;
+			std::vector<std::pair<std::size_t, std::size_t>> CallStack; // (axiom, next call) //
+			std::size_t NextIndex_UInt64{};
+			std::size_t Components_UInt64{};
+			for (std::size_t Root_UInt64 = 0; Root_UInt64 < Axioms_UInt64; ++Root_UInt64)
+			{
+				if (Index_UInt64Vec[Root_UInt64] != Unvisited)
+					continue;
+				CallStack.emplace_back(Root_UInt64, 0);
+				while (!CallStack.empty())
+				{
+					auto& [v, Next_UInt64] = CallStack.back();
+					if (Next_UInt64 == 0 && Index_UInt64Vec[v] == Unvisited)
+					{
+						Index_UInt64Vec[v] = LowLink_UInt64Vec[v] = NextIndex_UInt64++;
+						Stack.emplace_back(v);
+						OnStackFlagVec[v] = true;
+					}
+					if (Next_UInt64 < Calls_UInt64Vec[v].size())
+					{
+						const std::size_t w = Calls_UInt64Vec[v][Next_UInt64++];
+						if (Index_UInt64Vec[w] == Unvisited)
+							CallStack.emplace_back(w, 0);
+						else if (OnStackFlagVec[w])
+							LowLink_UInt64Vec[v] = std::min(LowLink_UInt64Vec[v], Index_UInt64Vec[w]);
+						continue;
+					}
+
+					const std::size_t Done_UInt64 = v;
+					CallStack.pop_back();
+					if (!CallStack.empty())
+						LowLink_UInt64Vec[CallStack.back().first] = std::min(LowLink_UInt64Vec[CallStack.back().first], LowLink_UInt64Vec[Done_UInt64]);
+					if (LowLink_UInt64Vec[Done_UInt64] != Index_UInt64Vec[Done_UInt64])
+						continue;
+
+					std::vector<std::size_t> Cluster;
+					std::size_t w;
+					do
+					{
+						w = Stack.back();
+						Stack.pop_back();
+						OnStackFlagVec[w] = false;
+						Component_UInt64Vec[w] = Components_UInt64;
+						Cluster.emplace_back(w);
+					} while (w != Done_UInt64);
+					++Components_UInt64;
+					if (Cluster.size() > 1)
+					{
+						for (const std::size_t a : Cluster)
+							CyclicFlagVec[a] = true;
+						std::sort(Cluster.begin(), Cluster.end());
+						Clusters_UInt64Vec.emplace_back(std::move(Cluster));
+					}
+				}
+			}
+
+			std::size_t Cyclic_UInt64{};
+			for (const std::vector<std::size_t>& Cluster : Clusters_UInt64Vec)
+				Cyclic_UInt64 += Cluster.size();
+			__stdlog__({ "AxiomRewriteGraph: ", std::to_string(Clusters_UInt64Vec.size()), " cyclic clusters, ", std::to_string(Cyclic_UInt64), " of ", std::to_string(Axioms_UInt64), " axioms in cycles" });
+		}
+
+		std::vector<std::vector<std::size_t>> Calls_UInt64Vec;
+
+		// Each side's (symbol, count) pairs; each symbol's sides //
+		std::unordered_map<std::string, std::size_t> Symbol_UInt64Map;
+		std::vector<std::vector<std::pair<std::size_t, std::size_t>>> Sides;
+		std::vector<std::vector<std::size_t>> Postings;
+
+		// The SCCs, analysed on demand once the calls have changed //
+		mutable bool bAnalysedFlag{};
+		mutable std::vector<std::size_t> Component_UInt64Vec;
+		mutable std::vector<std::vector<std::size_t>> Clusters_UInt64Vec;
+		mutable std::vector<bool> CyclicFlagVec;
+	};
+
+	/**
+	 * CompletedRewriteSystem : An axiom library compiled, by Knuth-Bendix completion, into a confluent set of oriented rules.
+	 * Nodes are prime composites - token multisets - so completion here is its commutative form (Buchberger's algorithm
+	 * on binomials): each equation is oriented the way EncodeAxioms rebalances an axiom, the larger composite rewriting
+	 * to the smaller (an order that multiplication preserves, and that no infinite chain can descend), and each pair of
+	 * rules whose LHSs share a symbol prime is resolved at their least common multiple, lowest first; a rule whose LHS
+	 * another rule reduces is retired, and its equation resumed. Once no equation is left, two composites are equal under
+	 * the axioms exactly when their normal forms are: a theorem whose sides normalize apart is unprovable, and one whose
+	 * sides meet is proven by both rewritten to their normal form - when the steps replay on the token strings (see Derive).
+	 * Completion may not converge; it gives up after InBudget_UInt64 equations, and the rules found so far still prove.
+	 * usage: const CompletedRewriteSystem System(EncodeAxioms(AxiomsStdStrVec, false), 1 << 16); if (System.Complete()) { System.NormalForm(LHS) == System.NormalForm(RHS) ... }
+	*/
+	class CompletedRewriteSystem
+	{
+	public:
+		CompletedRewriteSystem
+		(
+			// Axioms encoded as written (EncodeAxioms(..., false)), so that each step replays in its opcode's direction //
+			const
+			std::vector<
+			std::vector<
+			BigInt128_t>>&
+			InAxiomsRef,
+
+			const
+			std::size_t
+			InBudget_UInt64
+		)
+		{
+			__stdtracein__("CompletedRewriteSystem");
+
+			constexpr int LHS = 0;
+			constexpr int RHS = 1;
+
+			// Entries 0 .. n - 1 are the axioms themselves, the steps every rule's route unfolds into //
+			std::priority_queue<Equation_Struct> Equations;
+			for (std::size_t a = 0; a < InAxiomsRef.size(); ++a)
+			{
+				Entries.push_back({ InAxiomsRef[a][LHS], InAxiomsRef[a][RHS], {}, 1 });
+				Equations.push({ std::max(InAxiomsRef[a][LHS], InAxiomsRef[a][RHS]), InAxiomsRef[a][LHS], InAxiomsRef[a][RHS], { { a, true } } });
+			}
+			Axioms_UInt64 = InAxiomsRef.size();
+
+			std::size_t Equations_UInt64{};
+			while (!Equations.empty())
+			{
+				if (Equations_UInt64++ == InBudget_UInt64)
+				{
+					__stdlog__({ "CompletedRewriteSystem: budget of ", std::to_string(InBudget_UInt64), " equations spent, ", std::to_string(Equations.size()), " left" });
+					__stdtraceout__("CompletedRewriteSystem");
+					return;
+				}
+
+				Equation_Struct Equation = Equations.top();
+				Equations.pop();
+
+				// The route from the left normal form back up to the equation, across it, and down to the right normal form //
+				std::vector<Step_Struct> LeftRoute, RightRoute;
+				const BigInt128_t Left = Reduce(Equation.Left, &LeftRoute);
+				const BigInt128_t Right = Reduce(Equation.Right, &RightRoute);
+				if (Left == Right)
+					continue;
+
+				std::vector<Step_Struct> Route;
+				for (auto it = LeftRoute.rbegin(); it != LeftRoute.rend(); ++it)
+					Route.push_back({ it->Entry_UInt64, !it->bForwardFlag });
+				Route.insert(Route.end(), Equation.Route.begin(), Equation.Route.end());
+				Route.insert(Route.end(), RightRoute.begin(), RightRoute.end());
+
+				Entry_Struct Rule{ Left, Right, std::move(Route), 0 };
+				if (Left < Right)
+				{
+					std::swap(Rule.LHS, Rule.RHS);
+					std::reverse(Rule.Route.begin(), Rule.Route.end());
+					for (Step_Struct& Step : Rule.Route)
+						Step.bForwardFlag = !Step.bForwardFlag;
+				}
+				for (const Step_Struct& Step : Rule.Route)
+					Rule.Steps_UInt64 = std::min(Rule.Steps_UInt64 + Entries[Step.Entry_UInt64].Steps_UInt64, MaxSteps_UInt64);
+				const std::size_t New_UInt64 = Entries.size();
+				Entries.emplace_back(std::move(Rule));
+				const Entry_Struct& New = Entries[New_UInt64];
+
+				// Rules the new one reduces are retired, their equations resumed; the rest pair with it at their overlaps //
+				std::vector<std::size_t> Kept_UInt64Vec;
+				for (const std::size_t r : Rules_UInt64Vec)
+				{
+					const Entry_Struct& Old = Entries[r];
+					if (Old.LHS % New.LHS == 0)
+					{
+						Equations.push({ Old.LHS, Old.LHS, Old.RHS, { { r, true } } });
+						continue;
+					}
+					Kept_UInt64Vec.emplace_back(r);
+
+					const BigInt128_t Overlap = boost::multiprecision::gcd(Old.LHS, New.LHS);
+					if (Overlap == 1)
+						continue; // Coprime LHSs rewrite independently, and always rejoin //
+					const BigInt128_t Peak = Old.LHS / Overlap * New.LHS;
+					Equations.push({ Peak, Peak / Old.LHS * Old.RHS, Peak / New.LHS * New.RHS, { { r, false }, { New_UInt64, true } } });
+				}
+				Kept_UInt64Vec.emplace_back(New_UInt64);
+				Rules_UInt64Vec = std::move(Kept_UInt64Vec);
+			}
+
+			bCompleteFlag = true;
+			__stdlog__({ "CompletedRewriteSystem: ", std::to_string(Rules_UInt64Vec.size()), " rules after ", std::to_string(Equations_UInt64), " equations" });
+			__stdtraceout__("CompletedRewriteSystem");
+		}
+
+		// True when completion converged: normal forms then decide every theorem over these axioms //
+		bool Complete() const
+		{
+			return bCompleteFlag;
+		}
+
+		// Rules in the (possibly incomplete) system //
+		std::size_t size() const
+		{
+			return Rules_UInt64Vec.size();
+		}
+
+		BigInt128_t NormalForm(const BigInt128_t& InComposite) const
+		{
+			return Reduce(InComposite, nullptr);
+		}
+
+		/**
+		 * Derive() : Push the axiom steps rewriting a theorem side - InComposite, and its tokens InSideStdStrVec - to its
+		 * normal form onto InOutTheoremRef's proofstack, as opcode InOpcode_UInt64 (lhs_reduce, 0x00, or rhs_reduce, 0x02)
+		 * where a step runs its axiom as written, and InOpcode_UInt64 + 1 (the matching expand) where it runs it backwards.
+		 * Each rule is unfolded into its axiom steps and replayed on the tokens, as ProofVerified will; at every step the
+		 * first rule whose steps all replay is taken. Returns false, leaving InOutTheoremRef as it was, when the normal form
+		 * is not reached so, or only in more than InMaxSteps_UInt64 steps.
+		 * usage: System.Derive(Subnets[LHS], TheoremStdStrVec[LHS], AxiomsStdStrVec, 0x00, 1 << 12, Theorem) && System.Derive(Subnets[RHS], ...)
+		*/
+		bool Derive
+		(
+			const
+			BigInt128_t&
+			InComposite,
+
+			const
+			std::vector<
+			std::string>&
+			InSideStdStrVec,
+
+			const
+			std::vector<
+			std::vector<
+			std::vector<
+			std::string>>>&
+			InAxiomsStdStrVec,
+
+			const
+			std::size_t
+			InOpcode_UInt64,
+
+			const
+			std::size_t
+			InMaxSteps_UInt64,
+
+			std::vector<
+			BigInt128_t>&
+			InOutTheoremRef
+		) const
+		{
+			constexpr int LHS = 0;
+			constexpr int RHS = 1;
+
+			const BigInt128_t NormalForm_UInt64 = NormalForm(InComposite);
+			BigInt128_t Composite{ InComposite };
+			std::vector<std::string> SideStdStrVec{ InSideStdStrVec };
+			std::vector<BigInt128_t> ProofStack_UInt64Vec;
+
+			// Unfold a rule into the route it was derived by, down to axiom steps, replaying each (iteratively: routes nest deeply) //
+			auto Replay = [&](const std::size_t InRule_UInt64, std::vector<std::string>& InOutSideStdStrVecRef, std::vector<BigInt128_t>& OutStepsRef) -> bool
+			{
+				std::vector<std::pair<Step_Struct, std::size_t>> Unfold{ { { InRule_UInt64, true }, 0 } }; // (step, next step of its route) //
+				while (!Unfold.empty())
+				{
+					const Step_Struct Top = Unfold.back().first;
+					if (Top.Entry_UInt64 < Axioms_UInt64)
+					{
+						const std::vector<std::vector<std::string>>& Axiom_StdStrVec = InAxiomsStdStrVec[Top.Entry_UInt64];
+						if (!Rewrite(InOutSideStdStrVecRef, Axiom_StdStrVec[Top.bForwardFlag ? LHS : RHS], Axiom_StdStrVec[Top.bForwardFlag ? RHS : LHS]))
+							return false;
+						OutStepsRef.emplace_back(InOpcode_UInt64 + ( Top.bForwardFlag ? 0x00 : 0x01 ));
+						OutStepsRef.emplace_back(Top.Entry_UInt64 + 1);
+						Unfold.pop_back();
+						continue;
+					}
+					const std::vector<Step_Struct>& TopRoute = Entries[Top.Entry_UInt64].Route;
+					const std::size_t i = Unfold.back().second++;
+					if (i == TopRoute.size())
+					{
+						Unfold.pop_back();
+						continue;
+					}
+					const Step_Struct& Next = Top.bForwardFlag ? TopRoute[i] : TopRoute[TopRoute.size() - 1 - i];
+					Unfold.push_back({ { Next.Entry_UInt64, Next.bForwardFlag == Top.bForwardFlag }, 0 });
+				}
+				return true;
+			};
+
+			for (bool bReducedFlag = true; bReducedFlag; )
+			{
+				bReducedFlag = false;
+				for (const std::size_t r : Rules_UInt64Vec)
+				{
+					if (Composite % Entries[r].LHS != 0 || ProofStack_UInt64Vec.size() / 2 + Entries[r].Steps_UInt64 > InMaxSteps_UInt64)
+						continue;
+					std::vector<std::string> RewrittenStdStrVec{ SideStdStrVec };
+					std::vector<BigInt128_t> Steps_UInt64Vec;
+					if (!Replay(r, RewrittenStdStrVec, Steps_UInt64Vec))
+						continue;
+					SideStdStrVec = std::move(RewrittenStdStrVec);
+					ProofStack_UInt64Vec.insert(ProofStack_UInt64Vec.end(), Steps_UInt64Vec.begin(), Steps_UInt64Vec.end());
+					Composite = Composite / Entries[r].LHS * Entries[r].RHS;
+					bReducedFlag = true;
+					break;
+				}
+			}
+
+			if (Composite != NormalForm_UInt64)
+				return false;
+			InOutTheoremRef.insert(InOutTheoremRef.end(), ProofStack_UInt64Vec.begin(), ProofStack_UInt64Vec.end());
+			return true;
+		}
+
+	private:
+		// An entry run forwards (LHS to RHS) or backwards //
+		struct Step_Struct
+		{
+			std::size_t Entry_UInt64{};
+			bool bForwardFlag{};
+		};
+
+		// An axiom (no route), or a rule LHS -> RHS and the route of entry steps from its LHS to its RHS //
+		struct Entry_Struct
+		{
+			BigInt128_t LHS;
+			BigInt128_t RHS;
+			std::vector<Step_Struct> Route;
+
+			// Axiom steps the route unfolds into (saturating at MaxSteps_UInt64) //
+			std::size_t Steps_UInt64{};
+		};
+
+		// Equations are resolved lowest peak first (the normal strategy), which keeps the intermediate rules small //
+		struct Equation_Struct
+		{
+			BigInt128_t Peak;
+			BigInt128_t Left;
+			BigInt128_t Right;
+			std::vector<Step_Struct> Route;
+
+			bool operator<(const Equation_Struct& InEquationRef) const
+			{
+				return Peak > InEquationRef.Peak;
+			}
+		};
+
+		// Rewrite with the first rule that applies until none does; each rewrite lowers the composite, so this terminates //
+		BigInt128_t Reduce(BigInt128_t InComposite, std::vector<Step_Struct>* OutRoutePtr) const
+		{
+			for (bool bReducedFlag = true; bReducedFlag; )
+			{
+				bReducedFlag = false;
+				for (const std::size_t r : Rules_UInt64Vec)
+				{
+					if (InComposite % Entries[r].LHS != 0)
+						continue;
+					InComposite = InComposite / Entries[r].LHS * Entries[r].RHS;
+					if (OutRoutePtr)
+						OutRoutePtr->push_back({ r, true });
+					bReducedFlag = true;
+					break;
+				}
+			}
+			return InComposite;
+		}
+
+		static constexpr std::size_t MaxSteps_UInt64 = std::numeric_limits<std::size_t>::max() / 2;
+
+		std::vector<Entry_Struct> Entries;
+		std::size_t Axioms_UInt64{};
+
+		// The entries in use as rules, oldest first //
+		std::vector<std::size_t> Rules_UInt64Vec;
+
+		bool bCompleteFlag{};
+	};
+
+	/**
+	 * EncodingKey() : A hash of an encoded axiom library's composites (and guids, and directions), seeded with InSeed_UInt64,
+	 * which keys the objects built from one encoding.
+	*/
+	std::uint64_t EncodingKey
+	(
+		const
+		std::vector<
+		std::vector<
+		BigInt128_t>>&
+		InAxiomsRef,
+
+		const
+		std::size_t
+		InSeed_UInt64
+	)
+	{
+		std::size_t Key_UInt64 = std::hash<std::size_t>{}(InSeed_UInt64);
+		for (const std::vector<BigInt128_t>& Axiom_UInt64Vec : InAxiomsRef)
+			for (const BigInt128_t& Composite : Axiom_UInt64Vec)
+				Key_UInt64 ^= std::hash<BigInt128_t>{}(Composite) + 0x9e3779b97f4a7c15ULL + ( Key_UInt64 << 6 ) + ( Key_UInt64 >> 2 );
+		return Key_UInt64;
+	}
+
+	/**
+	 * CompletedRewriteSystemOf() : The CompletedRewriteSystem of an encoded axiom library, completed once per encoding
+	 * (the composites, and so the symbol table they were encoded against) and budget, and shared thereafter, for the few
+	 * encodings used most recently.
+	*/
+	std::shared_ptr<const CompletedRewriteSystem> CompletedRewriteSystemOf
+	(
+		const
+		std::vector<
+		std::vector<
+		BigInt128_t>>&
+		InAxiomsRef,
+
+		const
+		std::size_t
+		InBudget_UInt64
+	)
+	{
+		static SharedObjectCache<CompletedRewriteSystem> Systems{ 8 };
+		return Systems.FindOrBuild(EncodingKey(InAxiomsRef, InBudget_UInt64), [&]( ) { return std::make_shared<const CompletedRewriteSystem>(InAxiomsRef, InBudget_UInt64); });
+	}
+
+	/**
+	 * MovePruningTable : For each move (axiom * 4 + opcode, as ExpandTheorem numbers them), the moves that never need to
+	 * follow it, computed once from an encoded axiom library. Move m2 is pruned after m1 (both rewriting the same side)
+	 * when m1 then m2 multiplies that side's composite by 1 - a direct inverse, or an inverse via a duplicate axiom - or
+	 * by the same ratio as a single move m3 that applies wherever m1 then m2 does: the same state is one step closer
+	 * through m3, from m1's parent. A pruned pair can therefore never lie on a shortest route, so no state is lost.
+	 * Only pairs where m2 consumes a symbol m1 produced are considered (found through a symbol-prime index); the rest
+	 * commute. The table holds for composites: engines that confirm each move on the token strings keep RedundantMove().
+	 * A pruned pair's shortcut m3 is not checked on the strings, where it may reach a different token order (see
+	 * ProofSearchOptions_Struct::bMovePruningFlag).
+	 *
+	 * Commuting moves are reduced to one interleaving (partial-order reduction, by canonical ordering): moves on the two
+	 * sides always commute, and moves on one side commute when their axioms are independent - no symbol prime in common,
+	 * so either order applies and reaches the same composite. Sleeps() prunes m2 after m1 when they commute and m2 ranks
+	 * first in the order (RHS before LHS, then by axiom). Every pruned pair is replaced by a shorter, or an equally long
+	 * and earlier-ranked, sequence, so the first route in length-then-rank order to each state is never pruned
+	 * (move pruning in a tree search, which Tasks_Thread is: it keeps no closed set).
+	 * usage: ExpandTheorem(Theorem, Axioms_UInt64Vec, OnSuccessor, 0, MovePruningTableOf(Axioms_UInt64Vec).get());
+	*/
+	class MovePruningTable
+	{
+	public:
+		explicit MovePruningTable
+		(
+			const
+			std::vector<
+			std::vector<
+			BigInt128_t>>&
+			InAxiomsRef
+		) :
+			Pruned_UInt64Vec(InAxiomsRef.size() * 4),
+			AxiomSupport_UInt64Vec(InAxiomsRef.size())
+		{
+			__stdtracein__("MovePruningTable");
+
+			constexpr int LHS = 0;
+			constexpr int RHS = 1;
+			const std::size_t Moves_UInt64 = InAxiomsRef.size() * 4;
+
+			auto From = [&](const std::size_t m) -> const BigInt128_t& { return InAxiomsRef[m / 4][m & 0x01 ? RHS : LHS]; };
+			auto To = [&](const std::size_t m) -> const BigInt128_t& { return InAxiomsRef[m / 4][m & 0x01 ? LHS : RHS]; };
+			auto Side = [](const std::size_t m) -> std::size_t { return m % 4 >> 1; };
+
+			std::vector<BigInt128_t> SymbolPrimes_UInt64Vec;
+			for (const auto& [Symbol_StdStr, p] : SymbolToPrime_UInt64MultiMap)
+				SymbolPrimes_UInt64Vec.emplace_back(p);
+
+			// Each axiom side's distinct symbol primes, and an additive fingerprint of its prime multiset (a hashed log) //
+			auto PrimeHash = [](const BigInt128_t& InPrime) -> std::uint64_t
+			{
+				std::uint64_t Hash_UInt64 = std::hash<BigInt128_t>{}(InPrime) + 0x9e3779b97f4a7c15ULL;
+				Hash_UInt64 = ( Hash_UInt64 ^ ( Hash_UInt64 >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+				Hash_UInt64 = ( Hash_UInt64 ^ ( Hash_UInt64 >> 27 ) ) * 0x94d049bb133111ebULL;
+				return Hash_UInt64 ^ ( Hash_UInt64 >> 31 );
+			};
+			std::vector<std::array<std::vector<std::size_t>, 2>> Support(InAxiomsRef.size());
+			std::vector<std::array<std::uint64_t, 2>> Fingerprint(InAxiomsRef.size());
+			for (std::size_t a = 0; a < InAxiomsRef.size(); ++a)
+			{
+				for (const int i : { LHS, RHS })
+				{
+					BigInt128_t Rest = InAxiomsRef[a][i], Quotient, Remainder;
+					for (std::size_t j = 0; Rest > 1 && j < SymbolPrimes_UInt64Vec.size(); ++j)
+					{
+						for (boost::multiprecision::divide_qr(Rest, SymbolPrimes_UInt64Vec[j], Quotient, Remainder); Remainder == 0; boost::multiprecision::divide_qr(Rest, SymbolPrimes_UInt64Vec[j], Quotient, Remainder))
+						{
+							if (Support[a][i].empty() || Support[a][i].back() != j)
+								Support[a][i].emplace_back(j);
+							Fingerprint[a][i] += PrimeHash(SymbolPrimes_UInt64Vec[j]);
+							Rest = Quotient;
+						}
+					}
+				}
+			}
+			auto FromPrint = [&](const std::size_t m) -> std::uint64_t { return Fingerprint[m / 4][m & 0x01 ? RHS : LHS]; };
+			auto ToPrint = [&](const std::size_t m) -> std::uint64_t { return Fingerprint[m / 4][m & 0x01 ? LHS : RHS]; };
+
+			// Single moves, by side and the fingerprint of their ratio To / From; and the moves consuming each symbol prime, by side //
+			std::unordered_map<std::uint64_t, std::vector<std::size_t>> Shortcuts;
+			std::vector<std::array<std::vector<std::size_t>, 2>> Consumers(SymbolPrimes_UInt64Vec.size());
+			for (std::size_t m = 0; m < Moves_UInt64; ++m)
+			{
+				if (From(m) == To(m) || !DirectionAllowed(InAxiomsRef[m / 4], m))
+					continue; // No-ops on the composites are left to the search, and a lemma's backward move is never made //
+				Shortcuts[ToPrint(m) - FromPrint(m) + Side(m)].emplace_back(m);
+				for (const std::size_t j : Support[m / 4][m & 0x01 ? RHS : LHS])
+					Consumers[j][Side(m)].emplace_back(m);
+			}
+
+			std::size_t Pairs_UInt64{};
+			std::vector<std::size_t> Followers;
+			for (std::size_t m1 = 0; m1 < Moves_UInt64; ++m1)
+			{
+				if (From(m1) == To(m1) || !DirectionAllowed(InAxiomsRef[m1 / 4], m1))
+					continue;
+
+				Followers.assign(1, m1 ^ 0x01);
+				for (const std::size_t j : Support[m1 / 4][m1 & 0x01 ? LHS : RHS])
+					Followers.insert(Followers.end(), Consumers[j][Side(m1)].begin(), Consumers[j][Side(m1)].end());
+				std::sort(Followers.begin(), Followers.end());
+				Followers.erase(std::unique(Followers.begin(), Followers.end()), Followers.end());
+
+				for (const std::size_t m2 : Followers)
+				{
+					if (From(m2) == To(m2) || !DirectionAllowed(InAxiomsRef[m2 / 4], m2))
+						continue;
+
+					// The fingerprints screen each pair; the composites decide it //
+					const std::uint64_t Print_UInt64 = ToPrint(m1) + ToPrint(m2) - FromPrint(m1) - FromPrint(m2);
+					bool bPrunedFlag = Print_UInt64 == 0 && To(m1) * To(m2) == From(m1) * From(m2);
+					if (!bPrunedFlag)
+					{
+						if (const auto it = Shortcuts.find(Print_UInt64 + Side(m1)); it != Shortcuts.end())
+						{
+							// m1 then m2 needs at least From(m1), and the part of From(m2) that m1 did not produce //
+							const BigInt128_t Needed = From(m1) * ( From(m2) / boost::multiprecision::gcd(From(m2), To(m1)) );
+							bPrunedFlag = std::any_of
+							(
+								it->second.begin(), it->second.end(),
+								[&](const std::size_t m3) { return Side(m3) == Side(m1) && To(m1) * To(m2) * From(m3) == From(m1) * From(m2) * To(m3) && Needed % From(m3) == 0; }
+							);
+						}
+					}
+					if (bPrunedFlag)
+					{
+						Pruned_UInt64Vec[m1].emplace_back(m2);
+						++Pairs_UInt64;
+					}
+				}
+			}
+
+			// Axioms are independent when their supports (both sides) share no symbol prime: each axiom keeps its support, and
+			// Sleeps() intersects two of them. The relation itself is never materialized, as a symbol on every axiom (a "+")
+			// would make it dense //
+			std::size_t SupportPrimes_UInt64{};
+			for (std::size_t a = 0; a < InAxiomsRef.size(); ++a)
+			{
+				std::set_union(Support[a][LHS].begin(), Support[a][LHS].end(), Support[a][RHS].begin(), Support[a][RHS].end(), std::back_inserter(AxiomSupport_UInt64Vec[a]));
+				SupportPrimes_UInt64 += AxiomSupport_UInt64Vec[a].size();
+			}
+
+			__stdlog__({ "MovePruningTable: ", std::to_string(Pairs_UInt64), " move pairs pruned, ", std::to_string(SupportPrimes_UInt64), " support primes" });
+			__stdtraceout__("MovePruningTable");
+		}
+
+		// The moves pruned after InMove_UInt64, in ascending order //
+		const std::vector<std::size_t>& After(const std::size_t InMove_UInt64) const
+		{
+			return Pruned_UInt64Vec[InMove_UInt64];
+		}
+
+		// True when InMove_UInt64 commutes with InLastMove_UInt64 and ranks before it: the other interleaving is expanded instead //
+		bool Sleeps(const std::size_t InLastMove_UInt64, const std::size_t InMove_UInt64) const
+		{
+			const bool bLastLHSFlag = InLastMove_UInt64 % 4 < 0x02;
+			const bool bLHSFlag = InMove_UInt64 % 4 < 0x02;
+			if (bLastLHSFlag != bLHSFlag)
+				return bLastLHSFlag; // An RHS move after an LHS move //
+			return InMove_UInt64 / 4 < InLastMove_UInt64 / 4 && Independent(InLastMove_UInt64 / 4, InMove_UInt64 / 4);
+		}
+
+	private:
+		// True when axioms a and b share no symbol prime; an unencoded axiom (no support) commutes with nothing //
+		bool Independent(const std::size_t a, const std::size_t b) const
+		{
+			const std::vector<std::size_t>& A = AxiomSupport_UInt64Vec[a];
+			const std::vector<std::size_t>& B = AxiomSupport_UInt64Vec[b];
+			if (A.empty() || B.empty())
+				return false;
+			for (std::size_t i = 0, j = 0; i < A.size() && j < B.size(); )
+			{
+				if (A[i] == B[j])
+					return false;
+				A[i] < B[j] ? ++i : ++j;
+			}
+			return true;
+		}
+
+		std::vector<std::vector<std::size_t>> Pruned_UInt64Vec;
+
+		// Each axiom's symbol primes, both sides, as ascending indices //
+		std::vector<std::vector<std::size_t>> AxiomSupport_UInt64Vec;
+	};
+
+	/**
+	 * MovePruningTableOf() : The MovePruningTable of an encoded axiom library, built once per encoding - so a sliced or
+	 * macro-extended library has its own - and shared thereafter, for the few encodings used most recently.
+	*/
+	std::shared_ptr<const MovePruningTable> MovePruningTableOf
+	(
+		const
+		std::vector<
+		std::vector<
+		BigInt128_t>>&
+		InAxiomsRef
+	)
+	{
+		static SharedObjectCache<MovePruningTable> Tables{ 8 };
+		return Tables.FindOrBuild(EncodingKey(InAxiomsRef, 0), [&]( ) { return std::make_shared<const MovePruningTable>(InAxiomsRef); });
+	}
+
+	/**
+	 * ExpandTheorem() : The successor generator shared by the search engines. Applies each axiom to a theorem node as
+	 * lhs_reduce (0x00), lhs_expand (0x01), rhs_reduce (0x02) and rhs_expand (0x03) - Module_0000 .. Module_0003 -
+	 * pushing the opcode and axiom guid onto the successor's proofstack. Moves are numbered axiom * 4 + opcode;
+	 * generation starts at InFirstMove_UInt64, and stops early when InOnSuccessorRef returns false.
+	 * With InPruningPtr, the moves its table prunes after the node's last move (axiom Theorem[last_UInt64], and the
+	 * opcode atop the proofstack), or puts to sleep behind it, are skipped.
+	*/
+	void ExpandTheorem
+	(
+		const
+		std::vector<
+		BigInt128_t>&
+		InTheoremRef,
+
+		const
+		std::vector<
+		std::vector<
+		BigInt128_t>>&
+		InAxiomsRef,
+
+		const
+		std::function<
+		bool(std::vector<BigInt128_t>&&, std::size_t)>&
+		InOnSuccessorRef,
+
+		const
+		std::size_t
+		InFirstMove_UInt64 = 0,
+
+		const
+		MovePruningTable*
+		InPruningPtr = nullptr
+	)
+	{
+		constexpr int LHS = 0;
+		constexpr int RHS = 1;
+		constexpr int guid_UInt64 = 2;
+		constexpr int last_UInt64 = 3;
+		constexpr std::size_t ProofStackUInt64 = 4;
+
+		static const std::vector<std::size_t> NonePruned{};
+		const bool bPruningFlag = InPruningPtr && InTheoremRef.size() > ProofStackUInt64;
+		const std::size_t LastMove_UInt64 = bPruningFlag ?
+			( static_cast<std::size_t>(InTheoremRef[last_UInt64]) - 1 ) * 4 + static_cast<std::size_t>(InTheoremRef[InTheoremRef.size() - 2]) : 0;
+		const std::vector<std::size_t>& Pruned = bPruningFlag ? InPruningPtr->After(LastMove_UInt64) : NonePruned;
+		auto NextPruned = std::lower_bound(Pruned.begin(), Pruned.end(), InFirstMove_UInt64);
+
+		for (std::size_t Move_UInt64 = InFirstMove_UInt64; Move_UInt64 < InAxiomsRef.size() * 4; ++Move_UInt64)
+		{
+			if (NextPruned != Pruned.end() && *NextPruned == Move_UInt64)
+			{
+				++NextPruned;
+				continue;
+			}
+
+			if (bPruningFlag && InPruningPtr->Sleeps(LastMove_UInt64, Move_UInt64))
+				continue;
+
+			const std::vector<BigInt128_t>& Axiom = InAxiomsRef[Move_UInt64 / 4];
+			const std::size_t opcode = Move_UInt64 % 4;
+			if (!DirectionAllowed(Axiom, opcode))
+				continue;
+
+			const int Side = opcode < 0x02 ? LHS : RHS;
+			const BigInt128_t& From = Axiom[opcode & 0x01 ? RHS : LHS];
+			const BigInt128_t& To = Axiom[opcode & 0x01 ? LHS : RHS];
+
+			if (InTheoremRef[Side] % From != 0)
+				continue;
+
+			std::vector<BigInt128_t> Theorem_i{ InTheoremRef };
+			Theorem_i[Side] = Theorem_i[Side] / From * To;
+			Theorem_i[last_UInt64] = Axiom[guid_UInt64];
+			Theorem_i.emplace_back(opcode); // Push the opcode onto the proofstack //
+			Theorem_i.emplace_back(Axiom[guid_UInt64]); // Push the Axiom ID onto the proofstack //
+
+			if (!InOnSuccessorRef(std::move(Theorem_i), Move_UInt64))
+				return;
+		}
+	}
+
+	/**
+	 * TokenCountHeuristic : Admissible distance estimate for the IDAStar and Beam engines. A rewrite changes the token
+	 * count of one side by at most MaxDelta_UInt64, so at least |tokens(LHS) - tokens(RHS)| / MaxDelta_UInt64 steps
+	 * remain - and at least one while LHS != RHS.
+	*/
+	struct TokenCountHeuristic
+	{
+		explicit TokenCountHeuristic
+		(
+			const
+			std::vector<
+			std::vector<
+			std::vector<
+			std::string>>>&
+			InAxiomsStdStrVec
+		)
+		{
+			for (const std::vector<std::vector<std::string>>& Axiom_StdStrVec : InAxiomsStdStrVec)
+			{
+				const std::size_t Delta_UInt64 = Axiom_StdStrVec[0].size() > Axiom_StdStrVec[1].size() ?
+					Axiom_StdStrVec[0].size() - Axiom_StdStrVec[1].size() : Axiom_StdStrVec[1].size() - Axiom_StdStrVec[0].size();
+				MaxDelta_UInt64 = std::max(MaxDelta_UInt64, Delta_UInt64);
+			}
+		}
+
+		std::size_t Estimate(const std::vector<std::vector<std::string>>& InTheoremStdStrVec) const
+		{
+			if (InTheoremStdStrVec[0] == InTheoremStdStrVec[1])
+				return 0;
+			const std::size_t LHSTokens_UInt64 = InTheoremStdStrVec[0].size();
+			const std::size_t RHSTokens_UInt64 = InTheoremStdStrVec[1].size();
+			const std::size_t Gap_UInt64 = LHSTokens_UInt64 > RHSTokens_UInt64 ? LHSTokens_UInt64 - RHSTokens_UInt64 : RHSTokens_UInt64 - LHSTokens_UInt64;
+			return std::max<std::size_t>(1, MaxDelta_UInt64 ? ( Gap_UInt64 + MaxDelta_UInt64 - 1 ) / MaxDelta_UInt64 : 0);
+		}
+
+		// Tie-break for the Beam engine (not admissible): the number of token positions at which LHS and RHS differ //
+		std::size_t Mismatch(const std::vector<std::vector<std::string>>& InTheoremStdStrVec) const
+		{
+			const std::size_t Common_UInt64 = std::min(InTheoremStdStrVec[0].size(), InTheoremStdStrVec[1].size());
+			std::size_t Mismatch_UInt64 = std::max(InTheoremStdStrVec[0].size(), InTheoremStdStrVec[1].size()) - Common_UInt64;
+			for (std::size_t i = 0; i < Common_UInt64; ++i)
+				Mismatch_UInt64 += InTheoremStdStrVec[0][i] != InTheoremStdStrVec[1][i];
+			return Mismatch_UInt64;
+		}
+
+		std::size_t MaxDelta_UInt64{};
+	};
+
+	/**
+	 * BoundedSearchNode_Struct : A theorem node of the IDAStar and Beam engines, with its token strings and (IDAStar) its next move.
+	*/
+	struct BoundedSearchNode_Struct
+	{
+		std::vector<BigInt128_t> Theorem;
+		std::vector<std::vector<std::string>> TheoremStdStrVec;
+		std::size_t NextMove_UInt64{};
+	};
+
+	/**
+	 * RewriteTheoremStdStr() : Apply an ExpandTheorem move (axiom * 4 + opcode) to a theorem's token strings, as ProofVerified replays it.
+	 * The prime composites only screen a move (divisibility); the token rewrite decides it, so every proof found replays as written.
+	*/
+	bool RewriteTheoremStdStr
+	(
+		std::vector<
+		std::vector<
+		std::string>>&
+		InOutTheoremStdStrVecRef,
+
+		const
+		std::vector<
+		std::vector<
+		std::vector<
+		std::string>>>&
+		InAxiomsStdStrVec,
+
+		const
+		std::size_t
+		InMove_UInt64
+	)
+	{
+		const std::vector<std::vector<std::string>>& Axiom_StdStrVec = InAxiomsStdStrVec[InMove_UInt64 / 4];
+		const std::size_t opcode = InMove_UInt64 % 4;
+		return Rewrite
+		(
+			InOutTheoremStdStrVecRef[opcode < 0x02 ? 0 : 1],
+			Axiom_StdStrVec[opcode & 0x01 ? 1 : 0],
+			Axiom_StdStrVec[opcode & 0x01 ? 0 : 1]
+		);
+	}
+
+	/**
+	 * BoundedSearchStateKey() : The closed-set key of a node: its goal-set target (guid) and token strings, so that
+	 * each target keeps its own routes.
+	*/
+	std::string BoundedSearchStateKey(const BoundedSearchNode_Struct& InNodeRef)
+	{
+		std::string State_StdStr = InNodeRef.Theorem[2].str();
+		for (const std::vector<std::string>& Subnet_StdStrVec : InNodeRef.TheoremStdStrVec)
+		{
+			State_StdStr.push_back('\x1d');
+			for (const std::string& Symbol_StdStr : Subnet_StdStrVec)
+				State_StdStr.append(Symbol_StdStr).push_back('\x1f');
+		}
+		return State_StdStr;
+	}
+
+	/**
+	 * RedundantMove() : True when InMove_UInt64 cannot shorten a proof from InTheoremRef: it reverts the last step
+	 * on the proofstack, or rewrites the RHS after the LHS - LHS and RHS rewrites commute, so every proof has an
+	 * equally long ordering with its RHS steps first.
+	*/
+	bool RedundantMove(const std::vector<BigInt128_t>& InTheoremRef, const std::size_t InMove_UInt64)
+	{
+		constexpr std::size_t ProofStackUInt64 = 4;
+		if (InTheoremRef.size() <= ProofStackUInt64)
+			return false;
+		const std::size_t opcode = static_cast<std::size_t>(InTheoremRef[InTheoremRef.size() - 2]);
+		const std::size_t guid = static_cast<std::size_t>(InTheoremRef.back());
+		return ( guid == InMove_UInt64 / 4 + 1 && ( opcode ^ 0x01 ) == InMove_UInt64 % 4 ) || ( opcode < 0x02 && InMove_UInt64 % 4 >= 0x02 );
+	}
+
+	/**
+	 * __ProveIDAStar__ : Iterative-deepening A* from each root, using ExpandTheorem and TokenCountHeuristic.
+	 * Only the current path is stored (each frame resumes its successor generation at NextMove_UInt64), so memory
+	 * is O(depth). InAxiomsRef must be encoded as written (EncodeAxioms(..., false)), to match InAxiomsStdStrVec.
+	 * A node whose LHS == RHS is handed to InOnGoalRef, which returns true to stop.
+	*/
+	bool __ProveIDAStar__
+	(
+		const
+		std::vector<
+		BoundedSearchNode_Struct>&
+		InRootsRef,
+
+		const
+		std::vector<
+		std::vector<
+		BigInt128_t>>&
+		InAxiomsRef,
+
+		const
+		std::vector<
+		std::vector<
+		std::vector<
+		std::string>>>&
+		InAxiomsStdStrVec,
+
+		const
+		std::function<
+		bool(const std::vector<BigInt128_t>&)>&
+		InOnGoalRef,
+
+		const
+		ProofSearchOptions_Struct&
+		InOptionsRef,
+
+		const
+		std::atomic<bool>&
+		InAbortFlagRef,
+
+		// Offered every node reached, for a partial proof (nullptr: not tracked) //
+		ClosestNodeTracker*
+		InOutClosestPtr = nullptr
+	)
+	{
+		__stdtracein__("__ProveIDAStar__");
+
+		const TokenCountHeuristic Heuristic(InAxiomsStdStrVec);
+
+		bool QED{};
+		std::size_t Bound_UInt64 = std::numeric_limits<std::size_t>::max();
+		for (const BoundedSearchNode_Struct& Root : InRootsRef)
+		{
+			if (Heuristic.Estimate(Root.TheoremStdStrVec) == 0 && ( QED = InOnGoalRef(Root.Theorem) ))
+				break;
+			Bound_UInt64 = std::min(Bound_UInt64, Heuristic.Estimate(Root.TheoremStdStrVec));
+		}
+
+		while (!QED && !InAbortFlagRef && Bound_UInt64 <= InOptionsRef.MaxDepth_UInt64)
+		{
+			__stdlog__({ "__ProveIDAStar__: f-bound ", std::to_string(Bound_UInt64) });
+			std::size_t NextBound_UInt64 = std::numeric_limits<std::size_t>::max();
+
+			for (const BoundedSearchNode_Struct& Root : InRootsRef)
+			{
+				if (Root.TheoremStdStrVec[0] == Root.TheoremStdStrVec[1])
+					continue;
+
+				std::vector<BoundedSearchNode_Struct> Path{ Root };
+				while (!Path.empty() && !QED && !InAbortFlagRef)
+				{
+					BoundedSearchNode_Struct& Node = Path.back();
+					const std::size_t g_UInt64 = Path.size(); // Depth of Node's successors //
+
+					std::optional<BoundedSearchNode_Struct> Successor;
+					ExpandTheorem
+					(
+						Node.Theorem,
+						InAxiomsRef,
+						[&](std::vector<BigInt128_t>&& InTheorem_iRef, const std::size_t InMove_UInt64) -> bool
+						{
+							Node.NextMove_UInt64 = InMove_UInt64 + 1;
+							if (RedundantMove(Node.Theorem, InMove_UInt64))
+								return true;
+
+							BoundedSearchNode_Struct Child{ std::move(InTheorem_iRef), Node.TheoremStdStrVec };
+							if (!RewriteTheoremStdStr(Child.TheoremStdStrVec, InAxiomsStdStrVec, InMove_UInt64))
+								return true;
+
+							const std::size_t f_UInt64 = g_UInt64 + Heuristic.Estimate(Child.TheoremStdStrVec);
+							if (f_UInt64 > Bound_UInt64)
+							{
+								NextBound_UInt64 = std::min(NextBound_UInt64, f_UInt64);
+								return true;
+							}
+
+							// A proof is not expanded further, as in __Prove__ //
+							if (f_UInt64 == g_UInt64)
+							{
+								QED = InOnGoalRef(Child.Theorem);
+								return !QED;
+							}
+
+							Successor = std::move(Child);
+							return false;
+						},
+						Node.NextMove_UInt64
+					);
+
+					if (Successor)
+					{
+						if (InOutClosestPtr)
+							InOutClosestPtr->Offer(Successor->Theorem, TokenDistance(Successor->TheoremStdStrVec));
+						Path.emplace_back(std::move(*Successor));
+					}
+					else if (!QED)
+						Path.pop_back();
+				}
+				if (QED || InAbortFlagRef)
+					break;
+			}
+
+			if (NextBound_UInt64 == std::numeric_limits<std::size_t>::max())
+				break; // The whole (finite) tree has been searched //
+			Bound_UInt64 = NextBound_UInt64;
+		}
+
+		__stdtraceout__("__ProveIDAStar__");
+		return QED;
+	}
+
+	/**
+	 * __ProveBeam__ : Fixed-width beam search from the roots, using ExpandTheorem and TokenCountHeuristic.
+	 * Each layer keeps its InOptionsRef.BeamWidth_UInt64 most promising distinct successors, so memory is
+	 * O(BeamWidth_UInt64 x depth). InAxiomsRef must be encoded as written (EncodeAxioms(..., false)), to match
+	 * InAxiomsStdStrVec. A node whose LHS == RHS is handed to InOnGoalRef, which returns true to stop.
+	 * The search is incomplete: a proof pruned from the beam is not found.
+	*/
+	bool __ProveBeam__
+	(
+		const
+		std::vector<
+		BoundedSearchNode_Struct>&
+		InRootsRef,
+
+		const
+		std::vector<
+		std::vector<
+		BigInt128_t>>&
+		InAxiomsRef,
+
+		const
+		std::vector<
+		std::vector<
+		std::vector<
+		std::string>>>&
+		InAxiomsStdStrVec,
+
+		const
+		std::function<
+		bool(const std::vector<BigInt128_t>&)>&
+		InOnGoalRef,
+
+		const
+		ProofSearchOptions_Struct&
+		InOptionsRef,
+
+		const
+		std::atomic<bool>&
+		InAbortFlagRef,
+
+		// Offered every node reached, for a partial proof (nullptr: not tracked) //
+		ClosestNodeTracker*
+		InOutClosestPtr = nullptr
+	)
+	{
+		__stdtracein__("__ProveBeam__");
+
+		const TokenCountHeuristic Heuristic(InAxiomsStdStrVec);
+		const std::size_t BeamWidth_UInt64 = std::max<std::size_t>(1, InOptionsRef.BeamWidth_UInt64);
+
+		bool QED{};
+
+		std::vector<BoundedSearchNode_Struct> Layer;
+		for (const BoundedSearchNode_Struct& Root : InRootsRef)
+		{
+			if (Heuristic.Estimate(Root.TheoremStdStrVec) == 0)
+			{
+				if (( QED = InOnGoalRef(Root.Theorem) ))
+					break;
+				continue;
+			}
+			Layer.emplace_back(Root);
+		}
+
+		for (std::size_t Depth_UInt64 = 0; !QED && !InAbortFlagRef && !Layer.empty() && Depth_UInt64 < InOptionsRef.MaxDepth_UInt64; ++Depth_UInt64)
+		{
+			// Ranked by (estimate, mismatch) //
+			std::vector<std::pair<std::pair<std::size_t, std::size_t>, BoundedSearchNode_Struct>> Candidates;
+			std::unordered_set<std::string> LayerStates;
+
+			for (const BoundedSearchNode_Struct& Node : Layer)
+			{
+				ExpandTheorem
+				(
+					Node.Theorem,
+					InAxiomsRef,
+					[&](std::vector<BigInt128_t>&& InTheorem_iRef, const std::size_t InMove_UInt64) -> bool
+					{
+						if (RedundantMove(Node.Theorem, InMove_UInt64))
+							return true;
+
+						BoundedSearchNode_Struct Child{ std::move(InTheorem_iRef), Node.TheoremStdStrVec };
+						if (!RewriteTheoremStdStr(Child.TheoremStdStrVec, InAxiomsStdStrVec, InMove_UInt64))
+							return true;
+
+						// A proof is not expanded further, as in __Prove__ //
+						const std::size_t h_UInt64 = Heuristic.Estimate(Child.TheoremStdStrVec);
+						if (h_UInt64 == 0)
+						{
+							QED = InOnGoalRef(Child.Theorem);
+							return !QED;
+						}
+
+						if (!LayerStates.emplace(BoundedSearchStateKey(Child)).second)
+							return true;
+
+						Candidates.emplace_back(std::make_pair(h_UInt64, Heuristic.Mismatch(Child.TheoremStdStrVec)), std::move(Child));
+						return true;
+					}
+				);
+				if (QED || InAbortFlagRef)
+					break;
+			}
+
+			if (Candidates.size() > BeamWidth_UInt64)
+			{
+				std::nth_element
+				(
+					Candidates.begin(), Candidates.begin() + static_cast<std::ptrdiff_t>(BeamWidth_UInt64), Candidates.end(),
+					[](const auto& a, const auto& b) { return a.first < b.first; }
+				);
+				Candidates.resize(BeamWidth_UInt64);
+			}
+
+			Layer.clear();
+			for (auto& [Rank, Child] : Candidates)
+			{
+				if (InOutClosestPtr)
+					InOutClosestPtr->Offer(Child.Theorem, TokenDistance(Child.TheoremStdStrVec));
+				Layer.emplace_back(std::move(Child));
+			}
+		}
+
+		__stdtraceout__("__ProveBeam__");
+		return QED;
+	}
+
+	/**
+	 * ConcurrentStateSet : A closed set of state keys, sharded by hash so that the workers of a level insert concurrently.
+	*/
+	class ConcurrentStateSet
+	{
+	public:
+		// True when InState_StdStr was not yet in the set //
+		bool Insert(std::string&& InState_StdStr)
+		{
+			Shard_Struct& Shard = Shards[std::hash<std::string>{}(InState_StdStr) % Shards.size()];
+			std::lock_guard<std::mutex> Lock(Shard.Mutex);
+			if (!Shard.States.emplace(std::move(InState_StdStr)).second)
+				return false;
+			++Size_UInt64;
+			return true;
+		}
+
+		std::size_t size() const noexcept
+		{
+			return Size_UInt64;
+		}
+
+	private:
+		struct Shard_Struct
+		{
+			std::mutex Mutex;
+			std::unordered_set<std::string> States;
+		};
+
+		std::vector<Shard_Struct> Shards = std::vector<Shard_Struct>(64);
+		std::atomic<std::size_t> Size_UInt64{};
+	};
+
+	/**
+	 * __ProveLevelSynchronous__ : Level-synchronous breadth-first search from the roots. Each level's frontier is
+	 * expanded by InOptionsRef.SearchWorkers_UInt64 threads (ExpandTheorem, then RewriteTheoremStdStr), deduplicated
+	 * against one ConcurrentStateSet, and merged into the next frontier once every worker is done; the frontiers are
+	 * then swapped. Levels are sorted, so the search does not depend on the worker count.
+	 * Every node whose LHS == RHS is found at its shortest depth and handed to InOnGoalRef, which returns true to stop.
+	 * With OutReachedPtr, every state reached within InOptionsRef.MaxDepth_UInt64 levels is appended, in level order.
+	 * InAxiomsRef must be encoded as written (EncodeAxioms(..., false)), to match InAxiomsStdStrVec.
+	*/
+	bool __ProveLevelSynchronous__
+	(
+		const
+		std::vector<
+		BoundedSearchNode_Struct>&
+		InRootsRef,
+
+		const
+		std::vector<
+		std::vector<
+		BigInt128_t>>&
+		InAxiomsRef,
+
+		const
+		std::vector<
+		std::vector<
+		std::vector<
+		std::string>>>&
+		InAxiomsStdStrVec,
+
+		const
+		std::function<
+		bool(const std::vector<BigInt128_t>&)>&
+		InOnGoalRef,
+
+		const
+		ProofSearchOptions_Struct&
+		InOptionsRef,
+
+		const
+		std::atomic<bool>&
+		InAbortFlagRef,
+
+		std::vector<
+		BoundedSearchNode_Struct>*
+		OutReachedPtr = nullptr,
+
+		// Offered every node reached, for a partial proof (nullptr: not tracked) //
+		ClosestNodeTracker*
+		InOutClosestPtr = nullptr
+	)
+	{
+		__stdtracein__("__ProveLevelSynchronous__");
+
+		auto IsGoal = [&InOnGoalRef](const BoundedSearchNode_Struct& InNodeRef) -> bool
+		{
+			return InOnGoalRef && InNodeRef.TheoremStdStrVec[0] == InNodeRef.TheoremStdStrVec[1];
+		};
+
+		auto LevelOrder = [](const BoundedSearchNode_Struct& a, const BoundedSearchNode_Struct& b) -> bool
+		{
+			return a.Theorem[2] != b.Theorem[2] ? a.Theorem[2] < b.Theorem[2] : a.TheoremStdStrVec < b.TheoremStdStrVec;
+		};
+
+		const std::size_t Workers_UInt64 = InOptionsRef.SearchWorkers_UInt64 ? InOptionsRef.SearchWorkers_UInt64 : std::max(1u, std::thread::hardware_concurrency());
+
+		bool QED{};
+		ConcurrentStateSet ClosedStates;
+		std::vector<BoundedSearchNode_Struct> Frontier;
+		std::vector<BoundedSearchNode_Struct> NextFrontier;
+
+		for (const BoundedSearchNode_Struct& Root : InRootsRef)
+		{
+			if (!ClosedStates.Insert(BoundedSearchStateKey(Root)))
+				continue;
+			if (OutReachedPtr)
+				OutReachedPtr->emplace_back(Root);
+			if (IsGoal(Root) && ( QED = InOnGoalRef(Root.Theorem) ))
+				break;
+			if (!IsGoal(Root))
+				Frontier.emplace_back(Root);
+		}
+
+		for (std::size_t Level_UInt64 = 0; !QED && !InAbortFlagRef && !Frontier.empty() && Level_UInt64 < InOptionsRef.MaxDepth_UInt64; ++Level_UInt64)
+		{
+			__stdlog__({ "__ProveLevelSynchronous__: level ", std::to_string(Level_UInt64), ", frontier ", std::to_string(Frontier.size()) });
+
+			std::vector<std::vector<BoundedSearchNode_Struct>> WorkerFrontiers(Workers_UInt64);
+			std::atomic<std::size_t> NextNode_UInt64{};
+			std::atomic<bool> StateLimitFlag{};
+
+			auto ExpandLevel = [&](const std::size_t InWorker_UInt64) -> void
+			{
+				for (std::size_t i = NextNode_UInt64++; i < Frontier.size() && !InAbortFlagRef && !StateLimitFlag; i = NextNode_UInt64++)
+				{
+					const BoundedSearchNode_Struct& Node = Frontier[i];
+					ExpandTheorem
+					(
+						Node.Theorem,
+						InAxiomsRef,
+						[&](std::vector<BigInt128_t>&& InTheorem_iRef, const std::size_t InMove_UInt64) -> bool
+						{
+							BoundedSearchNode_Struct Child{ std::move(InTheorem_iRef), Node.TheoremStdStrVec };
+							if (!RewriteTheoremStdStr(Child.TheoremStdStrVec, InAxiomsStdStrVec, InMove_UInt64))
+								return true;
+
+							if (InOptionsRef.StateLimit_UInt64 && ClosedStates.size() >= InOptionsRef.StateLimit_UInt64)
+							{
+								StateLimitFlag = true;
+								return false;
+							}
+
+							if (ClosedStates.Insert(BoundedSearchStateKey(Child)))
+								WorkerFrontiers[InWorker_UInt64].emplace_back(std::move(Child));
+							return true;
+						}
+					);
+				}
+			};
+
+			std::vector<std::future<void>> Workers;
+			for (std::size_t w = 1; w < Workers_UInt64; ++w)
+				Workers.emplace_back(std::async(std::launch::async, ExpandLevel, w));
+			ExpandLevel(0);
+			for (std::future<void>& Worker : Workers)
+				Worker.get();
+
+			NextFrontier.clear();
+			for (std::vector<BoundedSearchNode_Struct>& WorkerFrontier : WorkerFrontiers)
+				std::move(WorkerFrontier.begin(), WorkerFrontier.end(), std::back_inserter(NextFrontier));
+			std::sort(NextFrontier.begin(), NextFrontier.end(), LevelOrder);
+
+			if (OutReachedPtr)
+				OutReachedPtr->insert(OutReachedPtr->end(), NextFrontier.begin(), NextFrontier.end());
+
+			// A proof is not expanded further, as in __Prove__ //
+			Frontier.clear();
+			for (BoundedSearchNode_Struct& Node : NextFrontier)
+			{
+				if (InOutClosestPtr)
+					InOutClosestPtr->Offer(Node.Theorem, TokenDistance(Node.TheoremStdStrVec));
+				if (!IsGoal(Node))
+					Frontier.emplace_back(std::move(Node));
+				else if (!QED)
+					QED = InOnGoalRef(Node.Theorem);
+			}
+
+			if (StateLimitFlag)
+			{
+				__stdlog__({ "__ProveLevelSynchronous__: state limit reached" });
+				break;
+			}
+		}
+
+		__stdtraceout__("__ProveLevelSynchronous__");
+		return QED;
+	}
+
+	/**
+	 * AxiomCost() : The cost of axiom InAxiom_UInt64 (0-based); axioms without a cost cost 1.
+	*/
+	std::uint64_t AxiomCost(const std::vector<std::uint64_t>& InAxiomCosts_UInt64Vec, const std::size_t InAxiom_UInt64) noexcept
+	{
+		return InAxiom_UInt64 < InAxiomCosts_UInt64Vec.size() ? InAxiomCosts_UInt64Vec[InAxiom_UInt64] : 1;
+	}
+
+	/**
+	 * CheapestAxiomHeuristic : Consistent cost estimate for the MinimumCost engine. Every symbol whose count differs
+	 * between LHS and RHS must be rewritten by some axiom containing it, so the remaining cost is at least the largest,
+	 * over those symbols, of the cheapest such axiom - and at least the cheapest axiom while LHS != RHS.
+	 * A mismatched symbol no axiom contains makes the node a dead end (Estimate() == Unreachable_UInt64).
+	*/
+	struct CheapestAxiomHeuristic
+	{
+		static constexpr std::uint64_t Unreachable_UInt64 = std::numeric_limits<std::uint64_t>::max();
+
+		CheapestAxiomHeuristic
+		(
+			const
+			std::vector<
+			std::vector<
+			std::vector<
+			std::string>>>&
+			InAxiomsStdStrVec,
+
+			const
+			std::vector<
+			std::uint64_t>&
+			InAxiomCosts_UInt64Vec
+		)
+		{
+			for (std::size_t i = 0; i < InAxiomsStdStrVec.size(); ++i)
+			{
+				const std::uint64_t Cost_UInt64 = AxiomCost(InAxiomCosts_UInt64Vec, i);
+				MinCost_UInt64 = std::min(MinCost_UInt64, Cost_UInt64);
+				for (const std::vector<std::string>& Subnet_StdStrVec : InAxiomsStdStrVec[i])
+				{
+					for (const std::string& Symbol_StdStr : Subnet_StdStrVec)
+					{
+						const auto [it, bInsertedFlag] = CheapestAxiom_UInt64Map.try_emplace(Symbol_StdStr, Cost_UInt64);
+						it->second = std::min(it->second, Cost_UInt64);
+					}
+				}
+			}
+		}
+
+		std::uint64_t Estimate(const std::vector<std::vector<std::string>>& InTheoremStdStrVec) const
+		{
+			if (InTheoremStdStrVec[0] == InTheoremStdStrVec[1])
+				return 0;
+
+			std::unordered_map<std::string, std::int64_t> Balance_Int64Map;
+			for (const std::string& Symbol_StdStr : InTheoremStdStrVec[0])
+				++Balance_Int64Map[Symbol_StdStr];
+			for (const std::string& Symbol_StdStr : InTheoremStdStrVec[1])
+				--Balance_Int64Map[Symbol_StdStr];
+
+			std::uint64_t Estimate_UInt64 = MinCost_UInt64;
+			for (const auto& [Symbol_StdStr, Balance_Int64] : Balance_Int64Map)
+			{
+				if (!Balance_Int64)
+					continue;
+				const auto it = CheapestAxiom_UInt64Map.find(Symbol_StdStr);
+				if (it == CheapestAxiom_UInt64Map.end())
+					return Unreachable_UInt64;
+				Estimate_UInt64 = std::max(Estimate_UInt64, it->second);
+			}
+			return Estimate_UInt64;
+		}
+
+		std::uint64_t MinCost_UInt64{ Unreachable_UInt64 };
+		std::unordered_map<std::string, std::uint64_t> CheapestAxiom_UInt64Map;
+	};
+
+	/**
+	 * IndexedMinHeap : Binary min-heap of node ids, with the heap position of each id indexed, so that DecreaseKey()
+	 * re-prioritizes a queued node in O(log n) instead of queueing a duplicate.
+	 * Keys are (f, h): ties on f go to the node nearest its goal.
+	*/
+	class IndexedMinHeap
+	{
+	public:
+		using Key_t = std::pair<std::uint64_t, std::uint64_t>;
+
+		bool empty() const noexcept
+		{
+			return Heap.empty();
+		}
+
+		const Key_t& TopKey() const
+		{
+			return Heap.front().first;
+		}
+
+		void Push(const std::size_t InId_UInt64, const Key_t& InKey)
+		{
+			if (Position_UInt64Vec.size() <= InId_UInt64)
+				Position_UInt64Vec.resize(InId_UInt64 + 1, NotQueued_UInt64);
+			Heap.emplace_back(InKey, InId_UInt64);
+			Position_UInt64Vec[InId_UInt64] = Heap.size() - 1;
+			SiftUp(Heap.size() - 1);
+		}
+
+		// Lowers the key of a queued id (and queues an id that is not) //
+		void DecreaseKey(const std::size_t InId_UInt64, const Key_t& InKey)
+		{
+			if (InId_UInt64 >= Position_UInt64Vec.size() || Position_UInt64Vec[InId_UInt64] == NotQueued_UInt64)
+				return Push(InId_UInt64, InKey);
+			const std::size_t i = Position_UInt64Vec[InId_UInt64];
+			if (InKey < Heap[i].first)
+			{
+				Heap[i].first = InKey;
+				SiftUp(i);
+			}
+		}
+
+		std::size_t Pop()
+		{
+			const std::size_t Id_UInt64 = Heap.front().second;
+			Swap(0, Heap.size() - 1);
+			Heap.pop_back();
+			Position_UInt64Vec[Id_UInt64] = NotQueued_UInt64;
+			if (!Heap.empty())
+				SiftDown(0);
+			return Id_UInt64;
+		}
+
+	private:
+		static constexpr std::size_t NotQueued_UInt64 = std::numeric_limits<std::size_t>::max();
+
+		void Swap(const std::size_t i, const std::size_t j)
+		{
+			std::swap(Heap[i], Heap[j]);
+			Position_UInt64Vec[Heap[i].second] = i;
+			Position_UInt64Vec[Heap[j].second] = j;
+		}
+
+		void SiftUp(std::size_t i)
+		{
+			while (i && Heap[i].first < Heap[( i - 1 ) / 2].first)
+			{
+				Swap(i, ( i - 1 ) / 2);
+				i = ( i - 1 ) / 2;
+			}
+		}
+
+		void SiftDown(std::size_t i)
+		{
+			for (;;)
+			{
+				std::size_t Min_UInt64 = i;
+				for (const std::size_t Child_UInt64 : { 2 * i + 1, 2 * i + 2 })
+					if (Child_UInt64 < Heap.size() && Heap[Child_UInt64].first < Heap[Min_UInt64].first)
+						Min_UInt64 = Child_UInt64;
+				if (Min_UInt64 == i)
+					return;
+				Swap(i, Min_UInt64);
+				i = Min_UInt64;
+			}
+		}
+
+		std::vector<std::pair<Key_t, std::size_t>> Heap;
+		std::vector<std::size_t> Position_UInt64Vec;
+	};
+
+	/**
+	 * __ProveMinimumCost__ : A* from the roots over per-axiom costs (AxiomCost), using ExpandTheorem and
+	 * CheapestAxiomHeuristic. Each distinct state is stored once, with its cheapest known cost and parent; a cheaper
+	 * route to a queued state lowers its key in place (IndexedMinHeap::DecreaseKey). Nodes whose cost plus estimate
+	 * exceeds the best proof already generated for their target (or InOptionsRef.MaxCost_UInt64) are pruned.
+	 * The first proof popped for each target is a cheapest one; its trace is rebuilt from the parents and handed to
+	 * InOnGoalRef, which returns true to stop.
+	 * InAxiomsRef must be encoded as written (EncodeAxioms(..., false)), to match InAxiomsStdStrVec.
+	*/
+	bool __ProveMinimumCost__
+	(
+		const
+		std::vector<
+		BoundedSearchNode_Struct>&
+		InRootsRef,
+
+		const
+		std::vector<
+		std::vector<
+		BigInt128_t>>&
+		InAxiomsRef,
+
+		const
+		std::vector<
+		std::vector<
+		std::vector<
+		std::string>>>&
+		InAxiomsStdStrVec,
+
+		const
+		std::vector<
+		std::uint64_t>&
+		InAxiomCosts_UInt64Vec,
+
+		const
+		std::function<
+		bool(const std::vector<BigInt128_t>&)>&
+		InOnGoalRef,
+
+		const
+		ProofSearchOptions_Struct&
+		InOptionsRef,
+
+		const
+		std::atomic<bool>&
+		InAbortFlagRef,
+
+		// Offered every node reached, for a partial proof (nullptr: not tracked) //
+		ClosestNodeTracker*
+		InOutClosestPtr = nullptr
+	)
+	{
+		__stdtracein__("__ProveMinimumCost__");
+
+		constexpr int guid_UInt64 = 2;
+		constexpr std::size_t ProofStackUInt64 = 4;
+		constexpr std::size_t NoParent_UInt64 = std::numeric_limits<std::size_t>::max();
+
+		const CheapestAxiomHeuristic Heuristic(InAxiomsStdStrVec, InAxiomCosts_UInt64Vec);
+
+		struct Record_Struct
+		{
+			BoundedSearchNode_Struct Node;
+			std::uint64_t Cost_UInt64{};
+			std::size_t Parent_UInt64{};
+			std::size_t Move_UInt64{};
+			bool bClosedFlag{};
+		};
+
+		std::vector<Record_Struct> Records;
+		std::unordered_map<std::string, std::size_t> RecordIndex;
+		IndexedMinHeap Open;
+
+		// The cheapest proof generated so far, per goal-set target //
+		std::size_t Targets_UInt64{};
+		for (const BoundedSearchNode_Struct& Root : InRootsRef)
+			Targets_UInt64 = std::max(Targets_UInt64, static_cast<std::size_t>(Root.Theorem[guid_UInt64]) + 1);
+		std::vector<std::uint64_t> UpperBound_UInt64Vec(Targets_UInt64, InOptionsRef.MaxCost_UInt64 ? InOptionsRef.MaxCost_UInt64 : CheapestAxiomHeuristic::Unreachable_UInt64);
+		std::vector<bool> TargetDoneFlagVec(Targets_UInt64);
+
+		auto Offer = [&](BoundedSearchNode_Struct&& InNodeRef, const std::uint64_t InCost_UInt64, const std::size_t InParent_UInt64, const std::size_t InMove_UInt64) -> void
+		{
+			const std::uint64_t Estimate_UInt64 = Heuristic.Estimate(InNodeRef.TheoremStdStrVec);
+			std::uint64_t& UpperBound_UInt64 = UpperBound_UInt64Vec[static_cast<std::size_t>(InNodeRef.Theorem[guid_UInt64])];
+			if (Estimate_UInt64 == CheapestAxiomHeuristic::Unreachable_UInt64 || InCost_UInt64 > UpperBound_UInt64 || Estimate_UInt64 > UpperBound_UInt64 - InCost_UInt64)
+				return;
+			if (Estimate_UInt64 == 0)
+				UpperBound_UInt64 = std::min(UpperBound_UInt64, InCost_UInt64);
+
+			const IndexedMinHeap::Key_t Key{ InCost_UInt64 + Estimate_UInt64, Estimate_UInt64 };
+			const auto [it, bInsertedFlag] = RecordIndex.try_emplace(BoundedSearchStateKey(InNodeRef), Records.size());
+			if (bInsertedFlag)
+			{
+				Records.push_back({ std::move(InNodeRef), InCost_UInt64, InParent_UInt64, InMove_UInt64 });
+				Open.Push(it->second, Key);
+				return;
+			}
+
+			Record_Struct& Record = Records[it->second];
+			if (Record.bClosedFlag || InCost_UInt64 >= Record.Cost_UInt64)
+				return;
+			Record.Node.Theorem = std::move(InNodeRef.Theorem);
+			Record.Cost_UInt64 = InCost_UInt64;
+			Record.Parent_UInt64 = InParent_UInt64;
+			Record.Move_UInt64 = InMove_UInt64;
+			Open.DecreaseKey(it->second, Key);
+		};
+
+		for (const BoundedSearchNode_Struct& Root : InRootsRef)
+			Offer(BoundedSearchNode_Struct{ { Root.Theorem.begin(), Root.Theorem.begin() + ProofStackUInt64 }, Root.TheoremStdStrVec }, 0, NoParent_UInt64, 0);
+
+		// The trace of a record, rebuilt from its parents //
+		auto Trace = [&](const std::size_t InId_UInt64) -> std::vector<BigInt128_t>
+		{
+			std::vector<std::size_t> Moves_UInt64Vec;
+			std::size_t Root_UInt64 = InId_UInt64;
+			for (; Records[Root_UInt64].Parent_UInt64 != NoParent_UInt64; Root_UInt64 = Records[Root_UInt64].Parent_UInt64)
+				Moves_UInt64Vec.emplace_back(Records[Root_UInt64].Move_UInt64);
+
+			std::vector<BigInt128_t> Theorem{ Records[Root_UInt64].Node.Theorem };
+			for (auto Move = Moves_UInt64Vec.rbegin(); Move != Moves_UInt64Vec.rend(); ++Move)
+			{
+				Theorem.emplace_back(*Move % 4); // Push the opcode onto the proofstack //
+				Theorem.emplace_back(*Move / 4 + 1); // Push the Axiom ID onto the proofstack //
+			}
+			Theorem[0] = Records[InId_UInt64].Node.Theorem[0];
+			Theorem[1] = Records[InId_UInt64].Node.Theorem[1];
+			return Theorem;
+		};
+
+		bool QED{};
+
+		while (!Open.empty() && !QED && !InAbortFlagRef)
+		{
+			const std::size_t Id_UInt64 = Open.Pop();
+			Records[Id_UInt64].bClosedFlag = true;
+
+			const std::size_t Target_UInt64 = static_cast<std::size_t>(Records[Id_UInt64].Node.Theorem[guid_UInt64]);
+			if (TargetDoneFlagVec[Target_UInt64])
+				continue;
+
+			// The trace is only rebuilt for a closer node //
+			if (InOutClosestPtr)
+			{
+				const std::size_t Distance_UInt64 = TokenDistance(Records[Id_UInt64].Node.TheoremStdStrVec);
+				if (Distance_UInt64 < InOutClosestPtr->Distance())
+					InOutClosestPtr->Offer(Trace(Id_UInt64), Distance_UInt64);
+			}
+
+			if (Records[Id_UInt64].Node.TheoremStdStrVec[0] == Records[Id_UInt64].Node.TheoremStdStrVec[1])
+			{
+				const std::vector<BigInt128_t> Theorem{ Trace(Id_UInt64) };
+
+				__stdlog__({ "__ProveMinimumCost__: proof of cost ", std::to_string(Records[Id_UInt64].Cost_UInt64) });
+				TargetDoneFlagVec[Target_UInt64] = true;
+				QED = InOnGoalRef(Theorem);
+				continue;
+			}
+
+			if (InOptionsRef.StateLimit_UInt64 && Records.size() >= InOptionsRef.StateLimit_UInt64)
+			{
+				__stdlog__({ "__ProveMinimumCost__: state limit reached" });
+				break;
+			}
+
+			// Offer() may grow Records, so expand a copy //
+			const BoundedSearchNode_Struct Node{ Records[Id_UInt64].Node };
+			const std::uint64_t Cost_UInt64 = Records[Id_UInt64].Cost_UInt64;
+			ExpandTheorem
+			(
+				Node.Theorem,
+				InAxiomsRef,
+				[&](std::vector<BigInt128_t>&& InTheorem_iRef, const std::size_t InMove_UInt64) -> bool
+				{
+					InTheorem_iRef.resize(ProofStackUInt64); // The trace is rebuilt from the parents //
+					BoundedSearchNode_Struct Child{ std::move(InTheorem_iRef), Node.TheoremStdStrVec };
+					if (RewriteTheoremStdStr(Child.TheoremStdStrVec, InAxiomsStdStrVec, InMove_UInt64))
+						Offer(std::move(Child), Cost_UInt64 + AxiomCost(InAxiomCosts_UInt64Vec, InMove_UInt64 / 4), Id_UInt64, InMove_UInt64);
+					return true;
+				}
+			);
+		}
+
+		__stdtraceout__("__ProveMinimumCost__");
+		return QED;
+	}
+
+	/**
+	 * EGraph : Hash-consed e-nodes in union-find e-classes, with a proof forest to explain every merge.
+	 * Nodes are prime composites - ground and flat, with no children - so an e-node is a state, congruence closure is
+	 * trivial, and an e-class is a set of states proven equal. Rewriting a composite is undone by the same axiom run the
+	 * other way, so the relation is symmetric and a union never overstates it. Each merge records the axiom step between
+	 * the two nodes merged as an edge of the proof forest (the smaller class's tree rerooted onto it, as in Nieuwenhuis
+	 * and Oliveras' explanations), so Explain() reads the steps between any two nodes of a class off the tree path.
+	 * usage: EGraph Graph; const std::size_t a = Graph.Add(LHS).first, b = Graph.Add(RHS).first; ... if (Graph.Find(a) == Graph.Find(b)) Graph.Explain(a, b);
+	*/
+	class EGraph
+	{
+	public:
+		// An axiom (0-based), run from its LHS to its RHS (forward) or back //
+		struct Step_Struct
+		{
+			std::size_t Axiom_UInt64{};
+			bool bForwardFlag{};
+		};
+
+		// The node of InComposite, and whether it is new //
+		std::pair<std::size_t, bool> Add(const BigInt128_t& InComposite)
+		{
+			const auto [it, bInsertedFlag] = Index.try_emplace(InComposite, Nodes.size());
+			if (bInsertedFlag)
+			{
+				Nodes.emplace_back(InComposite);
+				Parent_UInt64Vec.emplace_back(it->second);
+				Size_UInt64Vec.emplace_back(1);
+				ProofParent_UInt64Vec.emplace_back(it->second);
+				ProofStepVec.emplace_back();
+			}
+			return { it->second, bInsertedFlag };
+		}
+
+		std::size_t Find(std::size_t InNode_UInt64)
+		{
+			while (Parent_UInt64Vec[InNode_UInt64] != InNode_UInt64)
+				InNode_UInt64 = Parent_UInt64Vec[InNode_UInt64] = Parent_UInt64Vec[Parent_UInt64Vec[InNode_UInt64]];
+			return InNode_UInt64;
+		}
+
+		// Merge the e-classes of a and b, where InStep rewrites a into b; false when they are one class already //
+		bool Merge(std::size_t a, std::size_t b, Step_Struct InStep)
+		{
+			std::size_t ra = Find(a), rb = Find(b);
+			if (ra == rb)
+				return false;
+			if (Size_UInt64Vec[ra] > Size_UInt64Vec[rb])
+			{
+				std::swap(a, b);
+				std::swap(ra, rb);
+				InStep.bForwardFlag = !InStep.bForwardFlag;
+			}
+			Parent_UInt64Vec[ra] = rb;
+			Size_UInt64Vec[rb] += Size_UInt64Vec[ra];
+
+			// Reroot a's (the smaller) proof tree at a, reversing each edge on the way, then hang it from b //
+			std::size_t Node_UInt64 = a, Next_UInt64 = ProofParent_UInt64Vec[a];
+			Step_Struct Step = ProofStepVec[a];
+			while (Node_UInt64 != Next_UInt64)
+			{
+				const std::size_t After_UInt64 = ProofParent_UInt64Vec[Next_UInt64];
+				const Step_Struct AfterStep = ProofStepVec[Next_UInt64];
+				ProofParent_UInt64Vec[Next_UInt64] = Node_UInt64;
+				ProofStepVec[Next_UInt64] = { Step.Axiom_UInt64, !Step.bForwardFlag };
+				if (After_UInt64 == Next_UInt64)
+					break;
+				Node_UInt64 = Next_UInt64;
+				Next_UInt64 = After_UInt64;
+				Step = AfterStep;
+			}
+			ProofParent_UInt64Vec[a] = b;
+			ProofStepVec[a] = InStep;
+			return true;
+		}
+
+		// The steps rewriting node a into node b, of the same e-class: up a's proof tree to the common ancestor, then down to b //
+		std::vector<Step_Struct> Explain(const std::size_t a, const std::size_t b) const
+		{
+			std::unordered_map<std::size_t, std::size_t> Depth_UInt64Map; // a's ancestors, by distance from a //
+			for (std::size_t Node_UInt64 = a, Depth_UInt64 = 0; ; Node_UInt64 = ProofParent_UInt64Vec[Node_UInt64])
+			{
+				Depth_UInt64Map.emplace(Node_UInt64, Depth_UInt64++);
+				if (ProofParent_UInt64Vec[Node_UInt64] == Node_UInt64)
+					break;
+			}
+
+			std::vector<Step_Struct> Down;
+			std::size_t Ancestor_UInt64 = b;
+			for (; !Depth_UInt64Map.contains(Ancestor_UInt64); Ancestor_UInt64 = ProofParent_UInt64Vec[Ancestor_UInt64])
+				Down.push_back({ ProofStepVec[Ancestor_UInt64].Axiom_UInt64, !ProofStepVec[Ancestor_UInt64].bForwardFlag });
+
+			std::vector<Step_Struct> Steps;
+			for (std::size_t Node_UInt64 = a; Node_UInt64 != Ancestor_UInt64; Node_UInt64 = ProofParent_UInt64Vec[Node_UInt64])
+				Steps.emplace_back(ProofStepVec[Node_UInt64]);
+			Steps.insert(Steps.end(), Down.rbegin(), Down.rend());
+			return Steps;
+		}
+
+		const BigInt128_t& Node(const std::size_t InNode_UInt64) const
+		{
+			return Nodes[InNode_UInt64];
+		}
+
+		std::size_t size() const noexcept
+		{
+			return Nodes.size();
+		}
+
+	private:
+		std::unordered_map<BigInt128_t, std::size_t> Index;
+		std::vector<BigInt128_t> Nodes;
+
+		// Union-find over the e-classes (by size, with path halving) //
+		std::vector<std::size_t> Parent_UInt64Vec;
+		std::vector<std::size_t> Size_UInt64Vec;
+
+		// Proof forest: each node's parent, and the step rewriting the node into it (a root is its own parent) //
+		std::vector<std::size_t> ProofParent_UInt64Vec;
+		std::vector<Step_Struct> ProofStepVec;
+	};
+
+	/**
+	 * ExplainedTheorem() : Append an EGraph explanation, which rewrites a theorem's LHS into its RHS, to the theorem node
+	 * InOutTheoremRef: a prefix of the steps replayed on the LHS tokens (lhs opcodes), the rest undone from the RHS tokens
+	 * (rhs opcodes), split where the two token strings meet. The explanation holds over composites, and may run a lemma
+	 * backward, so it may not replay: false, with InOutTheoremRef unchanged, when no split does. Step axioms index InAxiomsStdStrVec (0-based).
+	*/
+	bool ExplainedTheorem
+	(
+		const
+		std::vector<
+		EGraph::Step_Struct>&
+		InStepsRef,
+
+		const
+		std::vector<
+		std::vector<
+		std::string>>&
+		InTheoremStdStrVec,
+
+		const
+		std::vector<
+		std::vector<
+		std::vector<
+		std::string>>>&
+		InAxiomsStdStrVec,
+
+		std::vector<
+		BigInt128_t>&
+		InOutTheoremRef
+	)
+	{
+		constexpr int LHS = 0;
+		constexpr int RHS = 1;
+		constexpr int last_UInt64 = 3;
+
+		auto Replay = [&](std::vector<std::string> InSideStdStrVec, const std::size_t InAxiom_UInt64, const bool InForwardFlag) -> std::vector<std::string>
+		{
+			const std::vector<std::vector<std::string>>& Axiom_StdStrVec = InAxiomsStdStrVec[InAxiom_UInt64];
+			if (( !InForwardFlag && DirectedAxiom(Axiom_StdStrVec) ) || !Rewrite(InSideStdStrVec, Axiom_StdStrVec[InForwardFlag ? LHS : RHS], Axiom_StdStrVec[InForwardFlag ? RHS : LHS]))
+				InSideStdStrVec.clear();
+			return InSideStdStrVec;
+		};
+
+		// The LHS after each replayable prefix, and the RHS before each replayable suffix //
+		std::vector<std::vector<std::string>> Forward_StdStrVec{ InTheoremStdStrVec[LHS] };
+		while (Forward_StdStrVec.size() <= InStepsRef.size())
+		{
+			const EGraph::Step_Struct& Step = InStepsRef[Forward_StdStrVec.size() - 1];
+			std::vector<std::string> Side_StdStrVec = Replay(Forward_StdStrVec.back(), Step.Axiom_UInt64, Step.bForwardFlag);
+			if (Side_StdStrVec.empty())
+				break;
+			Forward_StdStrVec.emplace_back(std::move(Side_StdStrVec));
+		}
+		std::vector<std::vector<std::string>> Backward_StdStrVec{ InTheoremStdStrVec[RHS] };
+		while (Backward_StdStrVec.size() <= InStepsRef.size())
+		{
+			const EGraph::Step_Struct& Step = InStepsRef[InStepsRef.size() - Backward_StdStrVec.size()];
+			std::vector<std::string> Side_StdStrVec = Replay(Backward_StdStrVec.back(), Step.Axiom_UInt64, !Step.bForwardFlag);
+			if (Side_StdStrVec.empty())
+				break;
+			Backward_StdStrVec.emplace_back(std::move(Side_StdStrVec));
+		}
+
+		std::size_t Prefix_UInt64 = Forward_StdStrVec.size();
+		while (Prefix_UInt64-- > 0)
+		{
+			const std::size_t Suffix_UInt64 = InStepsRef.size() - Prefix_UInt64;
+			if (Suffix_UInt64 < Backward_StdStrVec.size() && Forward_StdStrVec[Prefix_UInt64] == Backward_StdStrVec[Suffix_UInt64])
+				break;
+		}
+		if (Prefix_UInt64 > InStepsRef.size())
+			return false;
+
+		for (std::size_t i = 0; i < Prefix_UInt64; ++i)
+		{
+			InOutTheoremRef.emplace_back(InStepsRef[i].bForwardFlag ? 0x00 : 0x01);
+			InOutTheoremRef.emplace_back(InStepsRef[i].Axiom_UInt64 + 1);
+		}
+		for (std::size_t i = InStepsRef.size(); i-- > Prefix_UInt64; )
+		{
+			InOutTheoremRef.emplace_back(InStepsRef[i].bForwardFlag ? 0x03 : 0x02);
+			InOutTheoremRef.emplace_back(InStepsRef[i].Axiom_UInt64 + 1);
+		}
+		if (!InStepsRef.empty())
+			InOutTheoremRef[last_UInt64] = InOutTheoremRef.back();
+		return true;
+	}
+
+	/**
+	 * __ProveEqualitySaturation__ : Saturate an EGraph from the roots' LHS and targets. Each iteration applies every axiom,
+	 * both ways, to the e-nodes the previous iteration added, merging each rewrite into its node's e-class; it stops once
+	 * no e-node is added (saturation), after InOptionsRef.MaxDepth_UInt64 iterations, at InOptionsRef.StateLimit_UInt64
+	 * e-nodes, or when InAbortFlagRef is raised. A target is proven as soon as it shares the LHS's e-class: the
+	 * explanation is split between the two sides (see ExplainedTheorem) and handed to InOnGoalRef as a theorem node,
+	 * which returns true to stop. With InOutClosestPtr, each e-node rewritten that is in the LHS's or a target's e-class is
+	 * paired with the other side, and the closer pairs are offered as theorem nodes explained from the LHS and the target.
+	 * InAxiomsRef must be encoded as written (EncodeAxioms(..., false)), to match InAxiomsStdStrVec.
+	*/
+	bool __ProveEqualitySaturation__
+	(
+		const
+		std::vector<
+		BoundedSearchNode_Struct>&
+		InRootsRef,
+
+		const
+		std::vector<
+		std::vector<
+		BigInt128_t>>&
+		InAxiomsRef,
+
+		const
+		std::vector<
+		std::vector<
+		std::vector<
+		std::string>>>&
+		InAxiomsStdStrVec,
+
+		const
+		std::function<
+		bool(const std::vector<BigInt128_t>&)>&
+		InOnGoalRef,
+
+		const
+		ProofSearchOptions_Struct&
+		InOptionsRef,
+
+		const
+		std::atomic<bool>&
+		InAbortFlagRef,
+
+		// Offered the closest pair of LHS and target e-class members, for a partial proof (nullptr: not tracked) //
+		ClosestNodeTracker*
+		InOutClosestPtr = nullptr
+	)
+	{
+		__stdtracein__("__ProveEqualitySaturation__");
+
+		constexpr int LHS = 0;
+		constexpr int RHS = 1;
+		constexpr int guid_UInt64 = 2;
+
+		bool QED{};
+		EGraph Graph;
+		std::vector<std::size_t> Frontier;
+		if (InRootsRef.empty())
+		{
+			__stdtraceout__("__ProveEqualitySaturation__");
+			return QED;
+		}
+
+		const std::size_t LHSNode_UInt64 = Graph.Add(InRootsRef.front().Theorem[LHS]).first;
+		Frontier.emplace_back(LHSNode_UInt64);
+		std::vector<std::size_t> TargetNode_UInt64Vec;
+		std::vector<bool> ReachedFlagVec(InRootsRef.size());
+		for (const BoundedSearchNode_Struct& Root : InRootsRef)
+		{
+			const auto [Node_UInt64, bNewFlag] = Graph.Add(Root.Theorem[RHS]);
+			TargetNode_UInt64Vec.emplace_back(Node_UInt64);
+			if (bNewFlag)
+				Frontier.emplace_back(Node_UInt64);
+		}
+
+		// Hand each target newly in the LHS's e-class to InOnGoalRef, explained by the steps that replay on either side's tokens //
+		auto ProveReached = [&]( ) -> bool
+		{
+			for (std::size_t k = 0; k < InRootsRef.size(); ++k)
+			{
+				if (ReachedFlagVec[k] || Graph.Find(LHSNode_UInt64) != Graph.Find(TargetNode_UInt64Vec[k]))
+					continue;
+				ReachedFlagVec[k] = true;
+
+				std::vector<BigInt128_t> Theorem{ InRootsRef[k].Theorem };
+				if (!ExplainedTheorem(Graph.Explain(LHSNode_UInt64, TargetNode_UInt64Vec[k]), InRootsRef[k].TheoremStdStrVec, InAxiomsStdStrVec, Theorem))
+				{
+					__stdlog__({ "__ProveEqualitySaturation__: the explanation for target ", std::to_string(k), " does not replay on the tokens" });
+					continue;
+				}
+				if (InOnGoalRef(Theorem))
+					return true;
+			}
+			return false;
+		};
+
+		// The closest pair so far: a node of the LHS's e-class, one of target ClosestTarget_UInt64's, and whether there is one //
+		std::size_t ClosestLHSNode_UInt64{}, ClosestRHSNode_UInt64{}, ClosestTarget_UInt64{};
+		bool bClosestFlag{};
+
+		// Pair a node of the LHS's e-class with the target-side node of the closest pair so far, and a node of its target's
+		// e-class with the LHS-side node; until there is one, with the targets unreached or the LHS. Each explanation replays
+		// on its own side //
+		auto OfferClosest = [&](const std::size_t InNode_UInt64) -> void
+		{
+			const std::size_t Class_UInt64 = Graph.Find(InNode_UInt64);
+			const bool bLHSClassFlag = Class_UInt64 == Graph.Find(LHSNode_UInt64);
+			std::vector<std::array<std::size_t, 3>> Pairs;
+			if (bClosestFlag && !ReachedFlagVec[ClosestTarget_UInt64])
+			{
+				if (bLHSClassFlag)
+					Pairs.push_back({ InNode_UInt64, ClosestRHSNode_UInt64, ClosestTarget_UInt64 });
+				else if (Class_UInt64 == Graph.Find(TargetNode_UInt64Vec[ClosestTarget_UInt64]))
+					Pairs.push_back({ ClosestLHSNode_UInt64, InNode_UInt64, ClosestTarget_UInt64 });
+			}
+			for (std::size_t k = 0; k < InRootsRef.size() && Pairs.empty(); ++k)
+			{
+				if (ReachedFlagVec[k])
+					continue;
+				if (bLHSClassFlag)
+					Pairs.push_back({ InNode_UInt64, TargetNode_UInt64Vec[k], k });
+				else if (Class_UInt64 == Graph.Find(TargetNode_UInt64Vec[k]))
+					Pairs.push_back({ LHSNode_UInt64, InNode_UInt64, k });
+			}
+
+			for (const auto& [LHSSide_UInt64, RHSSide_UInt64, k] : Pairs)
+			{
+				const std::size_t Distance_UInt64 = InOutClosestPtr->Distance(Graph.Node(LHSSide_UInt64), Graph.Node(RHSSide_UInt64));
+				if (Distance_UInt64 >= InOutClosestPtr->Distance())
+					continue;
+
+				std::vector<BigInt128_t> Theorem{ Graph.Node(LHSSide_UInt64), Graph.Node(RHSSide_UInt64), InRootsRef[k].Theorem[guid_UInt64], 0 };
+				for (const EGraph::Step_Struct& Step : Graph.Explain(LHSNode_UInt64, LHSSide_UInt64))
+				{
+					Theorem.emplace_back(Step.bForwardFlag ? 0x00 : 0x01);
+					Theorem.emplace_back(Step.Axiom_UInt64 + 1);
+				}
+				for (const EGraph::Step_Struct& Step : Graph.Explain(TargetNode_UInt64Vec[k], RHSSide_UInt64))
+				{
+					Theorem.emplace_back(Step.bForwardFlag ? 0x02 : 0x03);
+					Theorem.emplace_back(Step.Axiom_UInt64 + 1);
+				}
+				InOutClosestPtr->Offer(Theorem, Distance_UInt64);
+				ClosestLHSNode_UInt64 = LHSSide_UInt64;
+				ClosestRHSNode_UInt64 = RHSSide_UInt64;
+				ClosestTarget_UInt64 = k;
+				bClosestFlag = true;
+			}
+		};
+
+		QED = ProveReached();
+		for (std::size_t Iteration_UInt64 = 0; !QED && !InAbortFlagRef && !Frontier.empty() && Iteration_UInt64 < InOptionsRef.MaxDepth_UInt64; ++Iteration_UInt64)
+		{
+			__stdlog__({ "__ProveEqualitySaturation__: iteration ", std::to_string(Iteration_UInt64), ", ", std::to_string(Graph.size()), " e-nodes, ", std::to_string(Frontier.size()), " new" });
+
+			std::vector<std::size_t> NextFrontier;
+			bool bStateLimitFlag{};
+			for (std::size_t i = 0; i < Frontier.size() && !QED && !bStateLimitFlag && !InAbortFlagRef; ++i)
+			{
+				const BigInt128_t Composite{ Graph.Node(Frontier[i]) };
+				if (InOutClosestPtr)
+					OfferClosest(Frontier[i]);
+				for (std::size_t Move_UInt64 = 0; Move_UInt64 < InAxiomsRef.size() * 2 && !QED; ++Move_UInt64)
+				{
+					const std::vector<BigInt128_t>& Axiom = InAxiomsRef[Move_UInt64 / 2];
+					const bool bForwardFlag = Move_UInt64 % 2 == 0;
+					if (!DirectionAllowed(Axiom, Move_UInt64 % 2) || Composite % Axiom[bForwardFlag ? LHS : RHS] != 0)
+						continue;
+					const BigInt128_t& From = Axiom[bForwardFlag ? LHS : RHS];
+
+					if (InOptionsRef.StateLimit_UInt64 && Graph.size() >= InOptionsRef.StateLimit_UInt64)
+					{
+						bStateLimitFlag = true;
+						break;
+					}
+
+					const auto [Node_UInt64, bNewFlag] = Graph.Add(Composite / From * Axiom[bForwardFlag ? RHS : LHS]);
+					if (bNewFlag)
+						NextFrontier.emplace_back(Node_UInt64);
+					if (Graph.Merge(Frontier[i], Node_UInt64, { static_cast<std::size_t>(Axiom[guid_UInt64]) - 1, bForwardFlag }))
+						QED = ProveReached();
+				}
+			}
+			Frontier = std::move(NextFrontier);
+
+			if (bStateLimitFlag)
+			{
+				__stdlog__({ "__ProveEqualitySaturation__: StateLimit_UInt64 reached" });
+				break;
+			}
+		}
+
+		__stdtraceout__("__ProveEqualitySaturation__");
+		return QED;
+	}
+
+	/**
+	 * __ProveKBest__ : Stream the InK_UInt64 cheapest distinct proofs from the roots, cheapest first, to InOnProofRef
+	 * (the trace, and its cost), which returns true to stop. Returns the number of proofs delivered.
+	 * The state graph is explored by A* (as __ProveMinimumCost__), keeping every parent link of a settled node rather
+	 * than the cheapest alone. Once every node with f <= R is settled, every proof of cost <= R lies in the explored graph,
+	 * so the proofs are extracted from it - by recursive enumeration of the k shortest paths (Jimenez and Marzal's REA,
+	 * the path-extraction half of Eppstein's method) into a sink fed by every proven state - and the search only
+	 * widens R while fewer than InK_UInt64 proofs are known. Proofs are distinct paths, so a proof may revisit a state.
+	 * InAxiomsRef must be encoded as written (EncodeAxioms(..., false)), to match InAxiomsStdStrVec.
+	*/
+	std::size_t __ProveKBest__
+	(
+		const
+		std::vector<
+		BoundedSearchNode_Struct>&
+		InRootsRef,
+
+		const
+		std::vector<
+		std::vector<
+		BigInt128_t>>&
+		InAxiomsRef,
+
+		const
+		std::vector<
+		std::vector<
+		std::vector<
+		std::string>>>&
+		InAxiomsStdStrVec,
+
+		const
+		std::vector<
+		std::uint64_t>&
+		InAxiomCosts_UInt64Vec,
+
+		const
+		std::size_t
+		InK_UInt64,
+
+		const
+		std::function<
+		bool(const std::vector<BigInt128_t>&, std::uint64_t)>&
+		InOnProofRef,
+
+		const
+		ProofSearchOptions_Struct&
+		InOptionsRef,
+
+		const
+		std::atomic<bool>&
+		InAbortFlagRef
+	)
+	{
+		__stdtracein__("__ProveKBest__");
+
+		constexpr std::size_t ProofStackUInt64 = 4;
+		constexpr std::size_t None_UInt64 = std::numeric_limits<std::size_t>::max();
+
+		const CheapestAxiomHeuristic Heuristic(InAxiomsStdStrVec, InAxiomCosts_UInt64Vec);
+
+		// A parent link: the parent's record, the move from it (None_UInt64: a proven state into the sink), and its cost //
+		struct Link_Struct
+		{
+			std::size_t Parent_UInt64{};
+			std::size_t Move_UInt64{};
+			std::uint64_t Cost_UInt64{};
+		};
+
+		struct Record_Struct
+		{
+			BoundedSearchNode_Struct Node;
+			std::uint64_t Cost_UInt64{};
+			std::uint64_t Estimate_UInt64{};
+			std::vector<Link_Struct> Links;
+			std::size_t TreeLink_UInt64{ None_UInt64 }; // The link of the cheapest known route //
+			bool bRootFlag{};
+			bool bSettledFlag{};
+		};
+
+		std::vector<Record_Struct> Records;
+		std::unordered_map<std::string, std::size_t> RecordIndex;
+		IndexedMinHeap Open;
+		std::vector<Link_Struct> SinkLinks;
+
+		auto Offer = [&](BoundedSearchNode_Struct&& InNodeRef, const std::uint64_t InCost_UInt64, const Link_Struct& InLinkRef, const bool InRootFlag) -> void
+		{
+			const std::uint64_t Estimate_UInt64 = Heuristic.Estimate(InNodeRef.TheoremStdStrVec);
+			if (Estimate_UInt64 == CheapestAxiomHeuristic::Unreachable_UInt64 ||
+				( InOptionsRef.MaxCost_UInt64 && ( InCost_UInt64 > InOptionsRef.MaxCost_UInt64 || Estimate_UInt64 > InOptionsRef.MaxCost_UInt64 - InCost_UInt64 ) ))
+				return;
+
+			const auto [it, bInsertedFlag] = RecordIndex.try_emplace(BoundedSearchStateKey(InNodeRef), Records.size());
+			if (bInsertedFlag)
+				Records.push_back({ std::move(InNodeRef), InCost_UInt64, Estimate_UInt64, {}, None_UInt64, false, false });
+
+			Record_Struct& Record = Records[it->second];
+			if (InRootFlag)
+				Record.bRootFlag = true;
+			else
+				Record.Links.emplace_back(InLinkRef);
+
+			if (Record.bSettledFlag || ( !bInsertedFlag && ( InRootFlag || InCost_UInt64 >= Record.Cost_UInt64 ) ))
+				return;
+
+			Record.Cost_UInt64 = InCost_UInt64;
+			Record.TreeLink_UInt64 = InRootFlag ? None_UInt64 : Record.Links.size() - 1;
+			Open.DecreaseKey(it->second, { InCost_UInt64 + Estimate_UInt64, Estimate_UInt64 });
+		};
+
+		for (const BoundedSearchNode_Struct& Root : InRootsRef)
+			Offer(BoundedSearchNode_Struct{ { Root.Theorem.begin(), Root.Theorem.begin() + ProofStackUInt64 }, Root.TheoremStdStrVec }, 0, {}, true);
+
+		// Recursive enumeration of the k shortest paths; record Records.size() is the sink //
+		struct Path_Struct
+		{
+			std::uint64_t Cost_UInt64{};
+			std::size_t Link_UInt64{ None_UInt64 }; // None_UInt64: the empty path of a root //
+			std::size_t Rank_UInt64{}; // The rank of the path to the link's parent //
+		};
+
+		using Candidate_t = std::tuple<std::uint64_t, std::size_t, std::size_t>; // (cost, link, rank of the parent's path) //
+
+		std::vector<std::vector<Path_Struct>> Paths;
+		std::vector<std::set<Candidate_t>> Candidates;
+		std::vector<bool> InitFlagVec;
+		std::vector<bool> BusyFlagVec;
+
+		auto LinksOf = [&](const std::size_t v) -> const std::vector<Link_Struct>&
+		{
+			return v == Records.size() ? SinkLinks : Records[v].Links;
+		};
+
+		// The cheapest path to a settled node: the empty path of a root, or its tree link's - the tree links are acyclic //
+		auto FirstPath = [&](auto& Self, const std::size_t v) -> void
+		{
+			if (!Paths[v].empty())
+				return;
+			const std::size_t TreeLink_UInt64 = Records[v].TreeLink_UInt64;
+			if (TreeLink_UInt64 == None_UInt64)
+			{
+				Paths[v].push_back({});
+				return;
+			}
+			const Link_Struct Link = Records[v].Links[TreeLink_UInt64];
+			Self(Self, Link.Parent_UInt64);
+			Paths[v].push_back({ Paths[Link.Parent_UInt64][0].Cost_UInt64 + Link.Cost_UInt64, TreeLink_UInt64, 0 });
+		};
+
+		// Ensure the InRank_UInt64-th cheapest path to v exists (false: there is none) //
+		auto NextPath = [&](auto& Self, const std::size_t v, const std::size_t InRank_UInt64) -> bool
+		{
+			const bool bSinkFlag = v == Records.size();
+			if (!bSinkFlag)
+				FirstPath(FirstPath, v);
+			if (Paths[v].size() > InRank_UInt64)
+				return true;
+			if (BusyFlagVec[v])
+				return false; // Only a cycle of zero-cost moves leads back here before v's next path is known //
+
+			BusyFlagVec[v] = true;
+			if (!InitFlagVec[v])
+			{
+				// The other links, each from its parent's cheapest path //
+				InitFlagVec[v] = true;
+				const std::size_t TreeLink_UInt64 = bSinkFlag ? None_UInt64 : Records[v].TreeLink_UInt64;
+				for (std::size_t e = 0; e < LinksOf(v).size(); ++e)
+				{
+					const Link_Struct Link = LinksOf(v)[e];
+					if (e == TreeLink_UInt64)
+						continue;
+					FirstPath(FirstPath, Link.Parent_UInt64);
+					Candidates[v].emplace(Paths[Link.Parent_UInt64][0].Cost_UInt64 + Link.Cost_UInt64, e, 0);
+				}
+			}
+
+			bool bFoundFlag{ true };
+			while (Paths[v].size() <= InRank_UInt64)
+			{
+				// The successor of the last path: the same link, from the parent's next path //
+				if (!Paths[v].empty() && Paths[v].back().Link_UInt64 != None_UInt64)
+				{
+					const Path_Struct Last = Paths[v].back();
+					const Link_Struct Link = LinksOf(v)[Last.Link_UInt64];
+					if (Self(Self, Link.Parent_UInt64, Last.Rank_UInt64 + 1))
+						Candidates[v].emplace(Paths[Link.Parent_UInt64][Last.Rank_UInt64 + 1].Cost_UInt64 + Link.Cost_UInt64, Last.Link_UInt64, Last.Rank_UInt64 + 1);
+				}
+				if (Candidates[v].empty())
+				{
+					bFoundFlag = false;
+					break;
+				}
+				const auto [Cost_UInt64, Link_UInt64, Rank_UInt64] = *Candidates[v].begin();
+				Candidates[v].erase(Candidates[v].begin());
+				Paths[v].push_back({ Cost_UInt64, Link_UInt64, Rank_UInt64 });
+			}
+			BusyFlagVec[v] = false;
+			return bFoundFlag;
+		};
+
+		std::size_t Delivered_UInt64{};
+		bool bStopFlag{};
+
+		while (!bStopFlag && !InAbortFlagRef)
+		{
+			const bool bExhaustedFlag = Open.empty();
+			const bool bStateLimitFlag = InOptionsRef.StateLimit_UInt64 && Records.size() >= InOptionsRef.StateLimit_UInt64;
+
+			// Settle every node on the next f level; the graph then holds every proof of cost <= Radius_UInt64 //
+			const std::uint64_t Radius_UInt64 = bExhaustedFlag ? CheapestAxiomHeuristic::Unreachable_UInt64 : Open.TopKey().first;
+			while (!bStateLimitFlag && !Open.empty() && Open.TopKey().first == Radius_UInt64)
+			{
+				const std::size_t Id_UInt64 = Open.Pop();
+				Records[Id_UInt64].bSettledFlag = true;
+
+				if (Records[Id_UInt64].Estimate_UInt64 == 0)
+				{
+					SinkLinks.push_back({ Id_UInt64, None_UInt64, 0 });
+					continue;
+				}
+
+				const BoundedSearchNode_Struct Node{ Records[Id_UInt64].Node };
+				const std::uint64_t Cost_UInt64 = Records[Id_UInt64].Cost_UInt64;
+				ExpandTheorem
+				(
+					Node.Theorem,
+					InAxiomsRef,
+					[&](std::vector<BigInt128_t>&& InTheorem_iRef, const std::size_t InMove_UInt64) -> bool
+					{
+						InTheorem_iRef.resize(ProofStackUInt64); // The trace is rebuilt from the links //
+						BoundedSearchNode_Struct Child{ std::move(InTheorem_iRef), Node.TheoremStdStrVec };
+						const std::uint64_t LinkCost_UInt64 = AxiomCost(InAxiomCosts_UInt64Vec, InMove_UInt64 / 4);
+						if (RewriteTheoremStdStr(Child.TheoremStdStrVec, InAxiomsStdStrVec, InMove_UInt64))
+							Offer(std::move(Child), Cost_UInt64 + LinkCost_UInt64, { Id_UInt64, InMove_UInt64, LinkCost_UInt64 }, false);
+						return true;
+					}
+				);
+			}
+
+			// Extract the proofs now known to be among the cheapest, past those already delivered //
+			Paths.assign(Records.size() + 1, {});
+			Candidates.assign(Records.size() + 1, {});
+			InitFlagVec.assign(Records.size() + 1, false);
+			BusyFlagVec.assign(Records.size() + 1, false);
+
+			for (std::size_t r = 0; !bStopFlag && r < InK_UInt64 && NextPath(NextPath, Records.size(), r); ++r)
+			{
+				const std::uint64_t ProofCost_UInt64 = Paths[Records.size()][r].Cost_UInt64;
+				if (ProofCost_UInt64 > Radius_UInt64 && !bExhaustedFlag)
+					break;
+				if (r < Delivered_UInt64)
+					continue;
+
+				std::vector<std::size_t> Moves_UInt64Vec;
+				std::size_t v = Records.size();
+				Path_Struct Path = Paths[v][r];
+				while (Path.Link_UInt64 != None_UInt64)
+				{
+					const Link_Struct Link = LinksOf(v)[Path.Link_UInt64];
+					if (Link.Move_UInt64 != None_UInt64)
+						Moves_UInt64Vec.emplace_back(Link.Move_UInt64);
+					v = Link.Parent_UInt64;
+					Path = Paths[v][Path.Rank_UInt64];
+				}
+
+				std::vector<BigInt128_t> Theorem{ Records[v].Node.Theorem };
+				for (auto Move = Moves_UInt64Vec.rbegin(); Move != Moves_UInt64Vec.rend(); ++Move)
+				{
+					Theorem.emplace_back(*Move % 4); // Push the opcode onto the proofstack //
+					Theorem.emplace_back(*Move / 4 + 1); // Push the Axiom ID onto the proofstack //
+				}
+
+				__stdlog__({ "__ProveKBest__: proof ", std::to_string(r + 1), " of cost ", std::to_string(ProofCost_UInt64) });
+				++Delivered_UInt64;
+				bStopFlag = InOnProofRef(Theorem, ProofCost_UInt64);
+			}
+
+			if (Delivered_UInt64 >= InK_UInt64 || bExhaustedFlag || bStateLimitFlag)
+				break;
+		}
+
+		__stdtraceout__("__ProveKBest__");
+		return Delivered_UInt64;
+	}
+
+	/**
+	 * MacroOperators : Axiom chains mined from the commit logs of solved proofs, each compiled into a macro-axiom.
+	 * A chain is a run of consecutive steps on one side of a proof; it rewrites one expression, so it serves either side.
+	 * Its macro-axiom rewrites the least composite the whole chain applies to (each step's LHS, less what the steps
+	 * before it leave) into what the chain leaves of it, so BestFirst makes the multi-step rewrite in one move. The
+	 * chain itself is the macro's expansion: the search pushes its steps onto the proofstack in the macro's place, so
+	 * traces, checkpoints and cached proofs only ever name library axioms.
+	 * usage: MacroOperators Macros; Macros.Learn(CommitLogs, EncodeAxioms(AxiomsStdStrVec, false)); for (const auto& Macro : Macros.Compile(...)) { ... }
+	*/
+	class MacroOperators
+	{
+	public:
+		// An axiom (library index, 0-based), run from its LHS to its RHS (forward) or back //
+		struct Step_Struct
+		{
+			std::size_t Axiom_UInt64{};
+			bool bForwardFlag{};
+
+			bool operator==(const Step_Struct&) const = default;
+		};
+
+		struct Macro_Struct
+		{
+			std::vector<Step_Struct> Steps;
+
+			// Occurrences of the chain in the commit logs it was mined from //
+			std::size_t Support_UInt64{};
+		};
+
+		// A macro over the axioms one search sees: LHS rewrites into RHS by Steps, in that search's axiom numbering //
+		struct Compiled_Struct
+		{
+			BigInt128_t LHS;
+			BigInt128_t RHS;
+			std::vector<Step_Struct> Steps;
+		};
+
+		/**
+		 * Learn() : Count every chain of 2 to InMaxLength_UInt64 steps in InCommitLogsRef (one log per solved proof, as
+		 * ProofVerified writes them), and keep those seen at least InMinSupport_UInt64 times whose rewrite no axiom, nor
+		 * macro, already makes in one move. The InMaxMacros_UInt64 that save the most steps are retained (support x
+		 * (length - 1)), the new ones among them returned. InWrittenAxiomsRef: the library, EncodeAxioms(..., false).
+		*/
+		std::size_t Learn
+		(
+			const
+			std::vector<
+			std::vector<
+			std::string>>&
+			InCommitLogsRef,
+
+			const
+			std::vector<
+			std::vector<
+			BigInt128_t>>&
+			InWrittenAxiomsRef,
+
+			const std::size_t InMinSupport_UInt64 = 2,
+			const std::size_t InMaxLength_UInt64 = 4,
+			const std::size_t InMaxMacros_UInt64 = 16
+		)
+		{
+			__stdtracein__("MacroOperators::Learn");
+
+			constexpr int LHS = 0;
+			constexpr int RHS = 1;
+
+			std::map<std::vector<std::pair<std::size_t, bool>>, std::size_t> Support;
+			for (const std::vector<std::string>& CommitLog_StdStrVec : InCommitLogsRef)
+			{
+				// "lhs_reduce via Axiom_<index>": the side, the direction and the axiom of each step //
+				std::vector<Step_Struct> Run;
+				bool bRHSFlag{};
+				auto CountRun = [&]( ) -> void
+				{
+					for (std::size_t i = 0; i < Run.size(); ++i)
+					{
+						std::vector<std::pair<std::size_t, bool>> Chain{ { Run[i].Axiom_UInt64, Run[i].bForwardFlag } };
+						for (std::size_t j = i + 1; j < Run.size() && Chain.size() < InMaxLength_UInt64; ++j)
+						{
+							Chain.emplace_back(Run[j].Axiom_UInt64, Run[j].bForwardFlag);
+							++Support[Chain];
+						}
+					}
+					Run.clear();
+				};
+				for (const std::string& Commit_StdStr : CommitLog_StdStrVec)
+				{
+					const std::size_t At_UInt64 = Commit_StdStr.rfind("Axiom_");
+					std::size_t Axiom_UInt64 = At_UInt64 == std::string::npos ? InWrittenAxiomsRef.size() : std::strtoull(Commit_StdStr.c_str() + At_UInt64 + 6, nullptr, 10);
+					if (Axiom_UInt64 < InWrittenAxiomsRef.size() && InWrittenAxiomsRef[Axiom_UInt64].size() < 3)
+						Axiom_UInt64 = InWrittenAxiomsRef.size(); // removed since //
+					if (Axiom_UInt64 >= InWrittenAxiomsRef.size() || ( Commit_StdStr.starts_with("rhs") != bRHSFlag ))
+						CountRun();
+					bRHSFlag = Commit_StdStr.starts_with("rhs");
+					if (Axiom_UInt64 < InWrittenAxiomsRef.size())
+						Run.push_back({ Axiom_UInt64, Commit_StdStr.find("reduce") != std::string::npos });
+				}
+				CountRun();
+			}
+
+			// A rewrite is known when some axiom or macro makes it, either way //
+			std::set<std::pair<BigInt128_t, BigInt128_t>> Known;
+			for (const std::vector<BigInt128_t>& Axiom : InWrittenAxiomsRef)
+			{
+				if (Axiom.size() < 3)
+					continue;
+				Known.emplace(Axiom[LHS], Axiom[RHS]);
+				Known.emplace(Axiom[RHS], Axiom[LHS]);
+			}
+			for (const Macro_Struct& Macro : Macros)
+			{
+				BigInt128_t From, To;
+				if (Composites(Macro.Steps, InWrittenAxiomsRef, [](const std::size_t InAxiom_UInt64) { return InAxiom_UInt64; }, From, To))
+				{
+					Known.emplace(From, To);
+					Known.emplace(To, From);
+				}
+			}
+
+			const std::vector<Macro_Struct> Previous{ Macros };
+			for (const auto& [Chain, Support_UInt64] : Support)
+			{
+				if (Support_UInt64 < InMinSupport_UInt64)
+					continue;
+
+				Macro_Struct Macro{ {}, Support_UInt64 };
+				for (const auto& [Axiom_UInt64, bForwardFlag] : Chain)
+					Macro.Steps.push_back({ Axiom_UInt64, bForwardFlag });
+
+				if (const auto Existing = std::find_if(Macros.begin(), Macros.end(), [&](const Macro_Struct& InMacroRef) { return InMacroRef.Steps == Macro.Steps; }); Existing != Macros.end())
+				{
+					Existing->Support_UInt64 += Support_UInt64;
+					continue;
+				}
+
+				BigInt128_t From, To;
+				if (!Composites(Macro.Steps, InWrittenAxiomsRef, [](const std::size_t InAxiom_UInt64) { return InAxiom_UInt64; }, From, To) || !Known.emplace(From, To).second)
+					continue;
+				Known.emplace(To, From);
+				Macros.emplace_back(std::move(Macro));
+			}
+
+			// Retain the macros saving the most steps, the older first among equals //
+			std::stable_sort(Macros.begin(), Macros.end(), [](const Macro_Struct& a, const Macro_Struct& b) { return a.Support_UInt64 * ( a.Steps.size() - 1 ) > b.Support_UInt64 * ( b.Steps.size() - 1 ); });
+			if (Macros.size() > InMaxMacros_UInt64)
+				Macros.resize(InMaxMacros_UInt64);
+			const std::size_t Learned_UInt64 = std::count_if(Macros.begin(), Macros.end(), [&](const Macro_Struct& InMacroRef)
+			{
+				return std::none_of(Previous.begin(), Previous.end(), [&](const Macro_Struct& InPreviousRef) { return InPreviousRef.Steps == InMacroRef.Steps; });
+			});
+
+			__stdlog__({ "MacroOperators::Learn: ", std::to_string(Learned_UInt64), " new macros, ", std::to_string(Macros.size()), " in all" });
+			__stdtraceout__("MacroOperators::Learn");
+			return Learned_UInt64;
+		}
+
+		/**
+		 * Compile() : The macros over the axioms one search sees, InAxiomsRef (EncodeAxioms(..., false)); InSearchAxiomRef maps
+		 * a library index to its index in InAxiomsRef (std::string::npos: sliced away, which drops any macro using it).
+		*/
+		std::vector<Compiled_Struct> Compile
+		(
+			const
+			std::vector<
+			std::vector<
+			BigInt128_t>>&
+			InAxiomsRef,
+
+			const
+			std::function<
+			std::size_t(std::size_t)>&
+			InSearchAxiomRef
+		) const
+		{
+			std::vector<Compiled_Struct> CompiledVec;
+			for (const Macro_Struct& Macro : Macros)
+			{
+				Compiled_Struct Compiled;
+				if (!Composites(Macro.Steps, InAxiomsRef, InSearchAxiomRef, Compiled.LHS, Compiled.RHS))
+					continue;
+				for (const Step_Struct& Step : Macro.Steps)
+					Compiled.Steps.push_back({ InSearchAxiomRef(Step.Axiom_UInt64), Step.bForwardFlag });
+				CompiledVec.emplace_back(std::move(Compiled));
+			}
+			return CompiledVec;
+		}
+
+		// One macro per line: its support, its length, then each step's axiom and direction (1: forward) //
+		bool Save(const std::string& InPathStdStr) const
+		{
+			std::ofstream File(InPathStdStr, std::ios::trunc);
+			for (const Macro_Struct& Macro : Macros)
+			{
+				File << Macro.Support_UInt64 << ' ' << Macro.Steps.size();
+				for (const Step_Struct& Step : Macro.Steps)
+					File << ' ' << Step.Axiom_UInt64 << ' ' << Step.bForwardFlag;
+				File << '\n';
+			}
+			return static_cast<bool>(File);
+		}
+
+		bool Load(const std::string& InPathStdStr)
+		{
+			std::ifstream File(InPathStdStr);
+			if (!File)
+				return false;
+
+			std::vector<Macro_Struct> LoadedVec;
+			std::size_t Steps_UInt64{};
+			for (Macro_Struct Macro; File >> Macro.Support_UInt64 >> Steps_UInt64; Macro.Steps.clear())
+			{
+				for (Step_Struct Step; Macro.Steps.size() < Steps_UInt64 && File >> Step.Axiom_UInt64 >> Step.bForwardFlag; )
+					Macro.Steps.emplace_back(Step);
+				if (Macro.Steps.size() < Steps_UInt64)
+					return false;
+				LoadedVec.emplace_back(Macro);
+			}
+			Macros = std::move(LoadedVec);
+			return true;
+		}
+
+		const std::vector<Macro_Struct>& Operators() const noexcept
+		{
+			return Macros;
+		}
+
+		std::size_t size() const noexcept
+		{
+			return Macros.size();
+		}
+
+		bool empty() const noexcept
+		{
+			return Macros.empty();
+		}
+
+	private:
+		// The least composite InStepsRef applies to, and what it leaves of it; false for a sliced or removed axiom, or no net rewrite //
+		static bool Composites
+		(
+			const std::vector<Step_Struct>& InStepsRef,
+			const std::vector<std::vector<BigInt128_t>>& InAxiomsRef,
+			const std::function<std::size_t(std::size_t)>& InSearchAxiomRef,
+			BigInt128_t& OutFromRef,
+			BigInt128_t& OutToRef
+		)
+		{
+			constexpr int LHS = 0;
+			constexpr int RHS = 1;
+
+			OutFromRef = OutToRef = 1;
+			for (const Step_Struct& Step : InStepsRef)
+			{
+				const std::size_t Axiom_UInt64 = InSearchAxiomRef(Step.Axiom_UInt64);
+				if (Axiom_UInt64 >= InAxiomsRef.size() || InAxiomsRef[Axiom_UInt64].size() < 3)
+					return false;
+				const BigInt128_t& From = InAxiomsRef[Axiom_UInt64][Step.bForwardFlag ? LHS : RHS];
+				const BigInt128_t Missing = From / boost::multiprecision::gcd(OutToRef, From);
+				OutFromRef *= Missing;
+				OutToRef = OutToRef * Missing / From * InAxiomsRef[Axiom_UInt64][Step.bForwardFlag ? RHS : LHS];
+			}
+			return OutFromRef != OutToRef;
+		}
+
+		std::vector<Macro_Struct> Macros;
+	};
+
+	// Generate Internal Route Map //
+	int __Prove__
+	(
+		const
+		std::vector<
+		std::vector<
+		std::string>>&
+		InTheoremStdStrVec,
+
+		const
+		std::vector<
+		std::vector<
+		std::vector<
+		std::string>>>&
+		InAxiomsStdStrVec,
+
+		// Per-axiom costs for the MinimumCost strategy (axioms without one cost 1) //
+		const
+		std::vector<
+		std::uint64_t>&
+		InAxiomCosts_UInt64Vec,
+
+		bool&
+		OutProofFound_FlagRef,
+
+		bool&
+		OutStatusReadyFlag,
+
+		std::vector<
+		std::vector<
+		std::vector<
+		std::string>>>&
+		OutProofStepStdStrVecRef,
+
+		std::vector<
+		std::vector<
+		std::string>>&
+		OutAxiomCommitLogStdStrVecRef,
+
+		std::vector<
+		std::size_t>&
+		OutReachedTargetsRef,
+
+		// Tokens left unmatched by the last step of a partial proof //
+		std::size_t&
+		OutRemainingDistance_UInt64Ref,
+
+		// Axioms sliced away before the search (see SliceAxioms) //
+		std::size_t&
+		OutSlicedAxioms_UInt64Ref,
+
+		ProofCheckpoint_Struct&
+		InOutCheckpointRef,
+
+		const
+		ProofSearchOptions_Struct&
+		InOptionsRef,
+
+		const
+		std::uint64_t
+		InAxiomSetVersion_UInt64,
+
+		// InAxiomsStdStrVec already encoded, as written (EncodeAxioms(..., false)), row for row: the prover's standing encoding,
+		// shared read-only by a ProveBatch (nullptr: encode InAxiomsStdStrVec here) //
+		const
+		std::vector<
+		std::vector<
+		BigInt128_t>>*
+		InEncodedAxiomsPtr,
+
+		// Macro-axioms learned for InAxiomsStdStrVec, which BestFirst also moves by (nullptr: none) //
+		const
+		MacroOperators*
+		InMacrosPtr,
+
+		// Counts this search as running until it returns; taken by the caller before it encoded anything //
+		[[maybe_unused]]
+		SearchGuard
+		InRunning
+	)
+	{
+		__stdtracein__("STDThreadProve");
+
+		TempProofSteps = {};
+
+		const std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now();
+		const std::chrono::steady_clock::time_point Deadline = Start + std::chrono::milliseconds(InOptionsRef.TimeBudgetMilliseconds_UInt64);
+		auto DeadlinePassed = [&]( ) -> bool
+		{
+			return InOptionsRef.TimeBudgetMilliseconds_UInt64 && std::chrono::steady_clock::now() >= Deadline;
+		};
+
+		OutRemainingDistance_UInt64Ref = 0;
+		OutSlicedAxioms_UInt64Ref = 0;
+
+		InOutCheckpointRef.SuspendedFlag = false;
+
+		// Resume() has restored the checkpoint's symbol table, so the theorem and axioms re-encode onto the suspended composites //
+		const bool bResumeFlag = !InOutCheckpointRef.ResumePathStdStr.empty();
+		std::unique_ptr<MappedFile> ResumeBlob;
+		if (bResumeFlag)
+			ResumeBlob = std::make_unique<MappedFile>(InOutCheckpointRef.ResumePathStdStr);
+
+		bool QED{};
+
+		std::vector<BigInt128_t> Theorem_UInt64Vec;
+
+		// A theorem { LHS, RHS_0, RHS_1, ... } is a goal set: reaching any one of its RHS targets proves it //
+		const bool bGoalSetFlag = InTheoremStdStrVec.size() > 2;
+
+		std::vector<BigInt128_t> Subnets_UInt64Vec;
+
+		std::vector<
+			std::vector<
+			std::vector<
+			std::string>>> TargetTheoremsStdStrVec;
+
+		for (std::size_t k = 1; k < InTheoremStdStrVec.size(); ++k)
+			TargetTheoremsStdStrVec.push_back({ InTheoremStdStrVec.front(), InTheoremStdStrVec[k] });
+
+		auto PopulateTheoremVec =
+			[
+				&
+			]
+		( ) -> void
+		{
+			__stdtracein__("PopulateTheoremVec");
+			const std::lock_guard<std::mutex> Lock(SymbolTableMutex);
+			for (const std::vector<std::string>& Subnet_StdStrVec : InTheoremStdStrVec)
+			{
+				BigInt128_t PrimeProduct_UInt64Vec{ 1 };
+				for (const std::string& Symbol_StdStr : Subnet_StdStrVec)
+				{
+					__stdlog__({ "'",Symbol_StdStr,"' " });
+					const auto& it = SymbolToPrime_UInt64MultiMap.find(Symbol_StdStr);
+					if (it != SymbolToPrime_UInt64MultiMap.end())
+					{
+						PrimeProduct_UInt64Vec *= it->second;
+						__stdlog__({ "Prime: ", Symbol_StdStr ," <- ",it->second.str(),", PrimeProduct: ", PrimeProduct_UInt64Vec.str() });
+					} else {
+						// This key/value pair is not in the prime number multimap...
+						const BigInt128_t p = Prime();
+						SymbolToPrime_UInt64MultiMap.emplace(Symbol_StdStr, p);
+						PrimeProduct_UInt64Vec *= p;
+						__stdlog__({ "New Prime: ", Symbol_StdStr ," <- ",p.str(),", PrimeProduct: ", PrimeProduct_UInt64Vec.str() });
+					}
+				}
+				__stdlog__({ "" });
+				Subnets_UInt64Vec.emplace_back(PrimeProduct_UInt64Vec);
+			}
+			Theorem_UInt64Vec.emplace_back(Subnets_UInt64Vec[0]);
+			Theorem_UInt64Vec.emplace_back(Subnets_UInt64Vec[1]);
+			Theorem_UInt64Vec.emplace_back(0); // guid (goal-set target index) //
+			Theorem_UInt64Vec.emplace_back(0); // last_UInt64 {"_root"}
+			__stdtraceout__("PopulateTheoremVec");
+		};
+
+		std::unordered_map<BigInt128_t, std::unordered_map<BigInt128_t, bool>> CallGraphUInt64Map{};
+
+		/*
+		Theorem
+		[LHS]
+		[RHS]
+		[guid_UInt64]
+		[last_UInt64]
+		[ProofStackUInt64]
+
+		Axiom
+		[LHS]
+		[RHS]
+		[guid_UInt64]
+		*/
+
+		constexpr int LHS = 0;
+		constexpr int RHS = 1;
+		constexpr int guid_UInt64 = 2;
+		constexpr int last_UInt64 = 3;
+		constexpr int ProofStackUInt64 = 4;
+
+		auto RebalanceTheoremVec =
+			[
+				&
+			]
+		( ) -> void
+		{
+			__stdtracein__("RebalanceTheoremVec");
+			BigInt128_t& lhs = Theorem_UInt64Vec[LHS];
+			BigInt128_t& rhs = Theorem_UInt64Vec[RHS];
+
+			if (lhs < rhs)
+			{
+				std::swap(lhs, rhs);
+			}
+			__stdtraceout__("RebalanceTheoremVec");
+		};
+
+		PopulateTheoremVec();
+		RebalanceTheoremVec();
+
+		// A resumed proof is searched by BestFirst, whatever the options now say //
+		const SearchStrategy_EnumClass Strategy = bResumeFlag ? SearchStrategy_EnumClass::BestFirst : InOptionsRef.SearchStrategy;
+		const std::uint64_t ProofKey_UInt64 = ProofObjectiveKey(InAxiomSetVersion_UInt64, Strategy);
+		const bool bOptimalProofFlag = ProofKey_UInt64 != ProofObjectiveKey(InAxiomSetVersion_UInt64, SearchStrategy_EnumClass::BestFirst);
+
+		// Repeat queries are answered from the proof cache, before the axiom library is encoded //
+		if (InOptionsRef.bProofCacheFlag && !bResumeFlag && !bGoalSetFlag)
+		{
+			std::vector<BigInt128_t> CachedTheorem_UInt64Vec;
+			if
+				(
+					ProofCacheGlobal.Find(ProofKey_UInt64, Theorem_UInt64Vec[LHS], Theorem_UInt64Vec[RHS], CachedTheorem_UInt64Vec) &&
+					ProofVerified
+					(
+						CachedTheorem_UInt64Vec,
+						InTheoremStdStrVec,
+						InAxiomsStdStrVec,
+						OutProofStepStdStrVecRef,
+						OutAxiomCommitLogStdStrVecRef
+					)
+				)
+			{
+				__stdlog__({ "Proof found in ProofCacheGlobal" });
+				__stdtraceout__("STDThreadProve\n");
+				OutReachedTargetsRef.emplace_back(0);
+				OutProofFound_FlagRef = true;
+				OutStatusReadyFlag = true; /* Set the Status Variable, last */
+				return true;
+			}
+			OutProofStepStdStrVecRef.clear();
+			OutAxiomCommitLogStdStrVecRef.clear();
+		}
+
+		// ...then from the on-disk proof store, which outlives the process and is shared by every worker on the host //
+		if (!InOptionsRef.ProofStoreDirectoryStdStr.empty() && !bResumeFlag && !bGoalSetFlag)
+		{
+			std::vector<BigInt128_t> StoredTheorem_UInt64Vec;
+			if
+				(
+					OpenProofStore(InOptionsRef.ProofStoreDirectoryStdStr).Find(InTheoremStdStrVec, ProofKey_UInt64, StoredTheorem_UInt64Vec) &&
+					ProofVerified
+					(
+						StoredTheorem_UInt64Vec,
+						InTheoremStdStrVec,
+						InAxiomsStdStrVec,
+						OutProofStepStdStrVecRef,
+						OutAxiomCommitLogStdStrVecRef
+					)
+				)
+			{
+				if (InOptionsRef.bProofCacheFlag)
+					ProofCacheGlobal.Insert(ProofKey_UInt64, Theorem_UInt64Vec[LHS], Theorem_UInt64Vec[RHS], StoredTheorem_UInt64Vec);
+
+				__stdlog__({ "Proof found in ProofStore" });
+				__stdtraceout__("STDThreadProve\n");
+				OutReachedTargetsRef.emplace_back(0);
+				OutProofFound_FlagRef = true;
+				OutStatusReadyFlag = true; /* Set the Status Variable, last */
+				return true;
+			}
+			OutProofStepStdStrVecRef.clear();
+			OutAxiomCommitLogStdStrVecRef.clear();
+		}
+
+		// Targets whose LHS - RHS lies outside the axioms' difference lattice can never be reached, nor can any node rooted at one //
+		std::vector<bool> FeasibleTargetFlagVec(TargetTheoremsStdStrVec.size(), true);
+		if (InOptionsRef.bLatticeCheckFlag && !bResumeFlag)
+		{
+			const std::shared_ptr<const AxiomLattice> Lattice = AxiomLatticeOf(InAxiomSetVersion_UInt64, InAxiomsStdStrVec);
+			for (std::size_t k = 0; k < TargetTheoremsStdStrVec.size(); ++k)
+				FeasibleTargetFlagVec[k] = Lattice->Contains(TargetTheoremsStdStrVec[k][LHS], TargetTheoremsStdStrVec[k][RHS]);
+
+			if (std::none_of(FeasibleTargetFlagVec.begin(), FeasibleTargetFlagVec.end(), [](const bool InFlag) { return InFlag; }))
+			{
+				__stdlog__({ "Unprovable: outside the axioms' difference lattice" });
+				__stdtraceout__("STDThreadProve\n");
+				OutProofFound_FlagRef = false;
+				OutStatusReadyFlag = true; /* Set the Status Variable, last */
+				return true;
+			}
+		}
+
+		// The engines see only the axioms the theorem can reach, renumbered 1..n; traces are mapped back to library guids on the way out //
+		std::vector<std::size_t> KeptAxioms_UInt64Vec;
+		std::vector<std::size_t> CompactGuid_UInt64Vec;
+		std::vector<std::vector<std::vector<std::string>>> SlicedAxiomsStdStrVec;
+		std::vector<std::uint64_t> SlicedAxiomCosts_UInt64Vec;
+		// Removed and offline axioms (empty entries; see EuclidProver::RemoveAxiom) are sliced away regardless //
+		const std::size_t Removed_UInt64 = std::count_if(InAxiomsStdStrVec.begin(), InAxiomsStdStrVec.end(), [](const std::vector<std::vector<std::string>>& InAxiomRef) { return InAxiomRef.size() < 2; });
+		if (InOptionsRef.bAxiomSlicingFlag)
+		{
+			KeptAxioms_UInt64Vec = SliceAxioms(InTheoremStdStrVec, InAxiomsStdStrVec);
+			OutSlicedAxioms_UInt64Ref = InAxiomsStdStrVec.size() - Removed_UInt64 - KeptAxioms_UInt64Vec.size();
+		}
+		else if (Removed_UInt64)
+		{
+			for (std::size_t a = 0; a < InAxiomsStdStrVec.size(); ++a)
+				if (InAxiomsStdStrVec[a].size() >= 2)
+					KeptAxioms_UInt64Vec.emplace_back(a);
+		}
+		const bool bSlicedFlag = OutSlicedAxioms_UInt64Ref > 0 || Removed_UInt64 > 0;
+		if (bSlicedFlag)
+		{
+			CompactGuid_UInt64Vec.resize(InAxiomsStdStrVec.size() + 1);
+			for (const std::size_t a : KeptAxioms_UInt64Vec)
+			{
+				SlicedAxiomsStdStrVec.emplace_back(InAxiomsStdStrVec[a]);
+				SlicedAxiomCosts_UInt64Vec.emplace_back(AxiomCost(InAxiomCosts_UInt64Vec, a));
+				CompactGuid_UInt64Vec[a + 1] = SlicedAxiomsStdStrVec.size();
+			}
+		}
+
+		const
+			std::vector<
+			std::vector<
+			std::vector<
+			std::string>>>& AxiomsStdStrVec = bSlicedFlag ? SlicedAxiomsStdStrVec : InAxiomsStdStrVec;
+
+		const
+			std::vector<
+			std::uint64_t>& AxiomCosts_UInt64Vec = bSlicedFlag ? SlicedAxiomCosts_UInt64Vec : InAxiomCosts_UInt64Vec;
+
+		// A node's axiom guids (its last step, and each step of its proofstack) between the library's numbering and the slice's //
+		auto ToLibraryGuids = [&](std::vector<BigInt128_t> InTheorem) -> std::vector<BigInt128_t>
+		{
+			if (bSlicedFlag)
+				for (std::size_t i = 3; i < InTheorem.size(); i += 2)
+					if (InTheorem[i] != 0)
+						InTheorem[i] = KeptAxioms_UInt64Vec[static_cast<std::size_t>(InTheorem[i]) - 1] + 1;
+			return InTheorem;
+		};
+		auto ToCompactGuids = [&](std::vector<BigInt128_t> InTheorem) -> std::vector<BigInt128_t>
+		{
+			if (bSlicedFlag)
+				for (std::size_t i = 3; i < InTheorem.size(); i += 2)
+					if (InTheorem[i] != 0)
+						InTheorem[i] = CompactGuid_UInt64Vec[static_cast<std::size_t>(InTheorem[i])];
+			return InTheorem;
+		};
+
+		// The axioms as written, row for row with AxiomsStdStrVec: the caller's rows, where it keeps them encoded, renumbered to the slice //
+		std::vector<
+			std::vector<
+			BigInt128_t>> LocalWrittenAxioms_UInt64Vec;
+
+		if (!InEncodedAxiomsPtr)
+			LocalWrittenAxioms_UInt64Vec = EncodeAxioms(AxiomsStdStrVec, false);
+		else if (bSlicedFlag)
+		{
+			LocalWrittenAxioms_UInt64Vec.reserve(KeptAxioms_UInt64Vec.size());
+			for (const std::size_t a : KeptAxioms_UInt64Vec)
+			{
+				LocalWrittenAxioms_UInt64Vec.emplace_back(( *InEncodedAxiomsPtr )[a]);
+				LocalWrittenAxioms_UInt64Vec.back()[guid_UInt64] = LocalWrittenAxioms_UInt64Vec.size();
+			}
+		}
+
+		const
+			std::vector<
+			std::vector<
+			BigInt128_t>>& WrittenAxioms_UInt64Vec = InEncodedAxiomsPtr && !bSlicedFlag ? *InEncodedAxiomsPtr : LocalWrittenAxioms_UInt64Vec;
+
+		// ...and rebalanced, for BestFirst //
+		std::vector<
+			std::vector<
+			BigInt128_t>> Axioms_UInt64Vec;
+
+		Axioms_UInt64Vec.reserve(WrittenAxioms_UInt64Vec.size());
+		for (const std::vector<BigInt128_t>& Axiom_UInt64Vec : WrittenAxioms_UInt64Vec)
+			Axioms_UInt64Vec.emplace_back(RebalancedAxiom(Axiom_UInt64Vec));
+
+		/*
+		std::vector<BigInt128_t> Theorem_UInt64Vec =
+		{
+			1585615607, // "1 + 1 + 1 + 1" (LHS)
+			29, // "4" (RHS)
+			0, // guid_UInt64;
+			0, // last_UInt64 == "_root"
+			--, // ProofStack_UInt64Vec
+		};
+
+		std::vector<std::vector<BigInt128_t>> Axioms_UInt64Vec =
+		{
+			{
+				8303, // "1 + 1" (RHS)
+				31, // "2" (LHS)
+				1, // guid_UInt64
+			},
+
+			{
+				22103, // "2 + 2" (RHS)
+				29, // "4" (LHS)
+				2, // guid_UInt64
+			}
+		};
+		*/
+
+		// Each feasible goal-set target is proven at most once //
+		const std::size_t MaxAllowedProofs_UInt64 = std::clamp<std::size_t>(InOptionsRef.MaxProofs_UInt64, 1, std::count(FeasibleTargetFlagVec.begin(), FeasibleTargetFlagVec.end(), true));
+		std::size_t TotalProofsFound_UInt64{};
+
+		using InternalProofStackUInt64Vec = std::vector<BigInt128_t>;
+		std::unordered_map<BigInt128_t, InternalProofStackUInt64Vec> LHSRouteHistoryMap, RHSRouteHistoryMap;
+
+		//std::unordered_map<BigInt128_t, bool> TimeoutEntropyQueue{}; // Measure the change in entropy in the Task_Thread //
+
+		bool bTimeoutFlag{};
+
+		// Tasks_Thread spills its cold nodes to disk beyond InOptionsRef.FrontierMemoryCeiling_UInt64; FastForwardTask_Thread holds at most one node //
+		ExternalMemoryFrontier Tasks_Thread(InOptionsRef.FrontierMemoryCeiling_UInt64, InOptionsRef.SpillDirectoryStdStr);
+
+		std::priority_queue<
+			std::vector<
+			BigInt128_t>> FastForwardTask_Thread;
+
+		bool bFastForwardFlag{};
+
+		auto WriteCheckpoint =
+			[
+				&
+			]
+		( ) -> bool
+		{
+			__stdtracein__("WriteCheckpoint");
+			std::ofstream Blob(InOutCheckpointRef.SuspendPathStdStr, std::ios::binary | std::ios::trunc);
+			if (!Blob)
+			{
+				__stdtraceout__("WriteCheckpoint");
+				return false;
+			}
+
+			CheckpointHeader_Struct Header{};
+			Blob.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+
+			auto BeginSection = [&](const CheckpointSection_EnumClass InSection, const std::uint64_t InRecords_UInt64) -> void
+			{
+				const std::size_t Section_UInt64 = static_cast<std::size_t>(InSection);
+				Header.SectionOffset_UInt64[Section_UInt64] = static_cast<std::uint64_t>(Blob.tellp());
+				Header.SectionRecords_UInt64[Section_UInt64] = InRecords_UInt64;
+			};
+
+			BeginSection(CheckpointSection_EnumClass::Symbols, SymbolToPrime_UInt64MultiMap.size());
+			for (const auto& [Symbol_StdStr, p] : SymbolToPrime_UInt64MultiMap)
+			{
+				CheckpointWriteStdStr(Blob, Symbol_StdStr);
+				CheckpointWriteBigInt(Blob, p);
+			}
+
+			BeginSection(CheckpointSection_EnumClass::Theorem, InTheoremStdStrVec.size());
+			for (const std::vector<std::string>& Subnet_StdStrVec : InTheoremStdStrVec)
+				CheckpointWriteStdStrVec(Blob, Subnet_StdStrVec);
+
+			BeginSection(CheckpointSection_EnumClass::Axioms, InAxiomsStdStrVec.size());
+			for (const std::vector<std::vector<std::string>>& Subnet_StdStrVec : InAxiomsStdStrVec)
+			{
+				CheckpointWriteUInt64(Blob, Subnet_StdStrVec.size());
+				for (const std::vector<std::string>& Expression_StdStrVec : Subnet_StdStrVec)
+					CheckpointWriteStdStrVec(Blob, Expression_StdStrVec);
+			}
+
+			// The queues are drained, in priority order, since the search is exiting anyway //
+			BeginSection(CheckpointSection_EnumClass::Tasks, Tasks_Thread.size());
+			for (; !Tasks_Thread.empty(); Tasks_Thread.pop())
+				CheckpointWriteBigIntVec(Blob, ToLibraryGuids(Tasks_Thread.top()));
+
+			BeginSection(CheckpointSection_EnumClass::FastForwardTasks, FastForwardTask_Thread.size());
+			for (; !FastForwardTask_Thread.empty(); FastForwardTask_Thread.pop())
+				CheckpointWriteBigIntVec(Blob, ToLibraryGuids(FastForwardTask_Thread.top()));
+
+			BeginSection(CheckpointSection_EnumClass::LHSRouteHistory, LHSRouteHistoryMap.size());
+			for (const auto& [Key, Route_UInt64Vec] : LHSRouteHistoryMap)
+			{
+				CheckpointWriteBigInt(Blob, Key);
+				CheckpointWriteBigIntVec(Blob, ToLibraryGuids(Route_UInt64Vec));
+			}
+
+			BeginSection(CheckpointSection_EnumClass::RHSRouteHistory, RHSRouteHistoryMap.size());
+			for (const auto& [Key, Route_UInt64Vec] : RHSRouteHistoryMap)
+			{
+				CheckpointWriteBigInt(Blob, Key);
+				CheckpointWriteBigIntVec(Blob, ToLibraryGuids(Route_UInt64Vec));
+			}
+
+			BeginSection(CheckpointSection_EnumClass::Counters, 1);
+			CheckpointWriteUInt64(Blob, TotalProofsFound_UInt64);
+			CheckpointWriteUInt64(Blob, bFastForwardFlag);
+
+			Blob.seekp(0);
+			Blob.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+			const bool bSuccessFlag = static_cast<bool>(Blob);
+			__stdtraceout__("WriteCheckpoint");
+			return bSuccessFlag;
+		};
+
+		auto ReadCheckpoint =
+			[
+				&
+			]
+		( ) -> bool
+		{
+			__stdtracein__("ReadCheckpoint");
+			CheckpointReader Reader;
+
+			std::uint64_t I = OpenCheckpointSection(*ResumeBlob, CheckpointSection_EnumClass::FastForwardTasks, Reader);
+			for (std::uint64_t i = 0; i < I && !Reader.OverrunFlag; ++i)
+				FastForwardTask_Thread.push(ToCompactGuids(Reader.ReadBigIntVec()));
+			bool bSuccessFlag = !Reader.OverrunFlag;
+
+			I = OpenCheckpointSection(*ResumeBlob, CheckpointSection_EnumClass::LHSRouteHistory, Reader);
+			LHSRouteHistoryMap.reserve(static_cast<std::size_t>(I));
+			for (std::uint64_t i = 0; i < I && !Reader.OverrunFlag; ++i)
+			{
+				BigInt128_t Key = Reader.ReadBigInt();
+				LHSRouteHistoryMap.emplace(std::move(Key), ToCompactGuids(Reader.ReadBigIntVec()));
+			}
+			bSuccessFlag = bSuccessFlag && !Reader.OverrunFlag;
+
+			I = OpenCheckpointSection(*ResumeBlob, CheckpointSection_EnumClass::RHSRouteHistory, Reader);
+			RHSRouteHistoryMap.reserve(static_cast<std::size_t>(I));
+			for (std::uint64_t i = 0; i < I && !Reader.OverrunFlag; ++i)
+			{
+				BigInt128_t Key = Reader.ReadBigInt();
+				RHSRouteHistoryMap.emplace(std::move(Key), ToCompactGuids(Reader.ReadBigIntVec()));
+			}
+			bSuccessFlag = bSuccessFlag && !Reader.OverrunFlag;
+
+			OpenCheckpointSection(*ResumeBlob, CheckpointSection_EnumClass::Counters, Reader);
+			TotalProofsFound_UInt64 = static_cast<std::size_t>(Reader.ReadUInt64());
+			bFastForwardFlag = Reader.ReadUInt64() != 0;
+			bSuccessFlag = bSuccessFlag && !Reader.OverrunFlag;
+
+			// The task queue was written best-first, as a spill run is: Tasks_Thread reads it in place, and removes the blob once drained //
+			I = OpenCheckpointSection(*ResumeBlob, CheckpointSection_EnumClass::Tasks, Reader);
+			bSuccessFlag = bSuccessFlag && !Reader.OverrunFlag &&
+				Tasks_Thread.AdoptRun(InOutCheckpointRef.ResumePathStdStr, I, static_cast<std::uint64_t>(Reader.Cursor - ResumeBlob->data()), ToCompactGuids);
+
+			__stdtraceout__("ReadCheckpoint");
+			return bSuccessFlag;
+		};
+
+		if (bResumeFlag)
+		{
+			if (!ReadCheckpoint())
+			{
+				__stdtraceout__("STDThreadProve");
+				OutProofFound_FlagRef = false;
+				OutStatusReadyFlag = true;
+				return false;
+			}
+			ResumeBlob.reset();
+		} else if (!bGoalSetFlag) {
+			Tasks_Thread.push(Theorem_UInt64Vec);
+		} else {
+			// One root per target, all seeded into RHSRouteHistoryMap at once; the shared LHS is not rebalanced, so that routes meet on it //
+			for (std::size_t k = 1; k < Subnets_UInt64Vec.size(); ++k)
+			{
+				if (!FeasibleTargetFlagVec[k - 1])
+					continue;
+				const std::vector<BigInt128_t> Root_UInt64Vec{ Subnets_UInt64Vec[0], Subnets_UInt64Vec[k], k - 1, 0 };
+				RHSRouteHistoryMap.emplace(Root_UInt64Vec[RHS], Root_UInt64Vec);
+				Tasks_Thread.push(Root_UInt64Vec);
+			}
+		}
+
+		// Todo: Implement thread-safe LHSFastForwardMap, RHSFastForwardMap for parrallel access via atomics
+		// Todo: Develop a proofstep generator that can infer solutions and their proofsteps from an axiom's CallGraph
+
+		// Routes to a goal-set target already proven are neither expanded nor fast-forwarded into, so the search moves on to the others //
+		auto TargetReached = [&](const BigInt128_t& InTarget_UInt64) -> bool
+		{
+			return std::find(OutReachedTargetsRef.begin(), OutReachedTargetsRef.end(), static_cast<std::size_t>(InTarget_UInt64)) != OutReachedTargetsRef.end();
+		};
+
+		// The node closest to a proof, offered by every engine; returned as a partial proof when the search ends without one.
+		// BestFirst, Bidirectional and EqualitySaturation nodes carry no strings: their distance is counted on the composites, over the symbol primes //
+		std::vector<BigInt128_t> SymbolPrimes_UInt64Vec;
+		if (InOptionsRef.bPartialProofFlag)
+		{
+			for (const auto& [Symbol_StdStr, p] : SymbolToPrime_UInt64MultiMap)
+				SymbolPrimes_UInt64Vec.emplace_back(p);
+			std::sort(SymbolPrimes_UInt64Vec.begin(), SymbolPrimes_UInt64Vec.end());
+		}
+		ClosestNodeTracker Closest{ SymbolPrimes_UInt64Vec };
+		ClosestNodeTracker* const ClosestPtr = InOptionsRef.bPartialProofFlag ? &Closest : nullptr;
+
+		auto ReturnPartialProof = [&]( ) -> void
+		{
+			if (!ClosestPtr || Closest.empty() || Closest.Theorem().size() <= ProofStackUInt64)
+				return;
+
+			// A BestFirst trace rewrites the rebalanced theorem with the rebalanced axioms: map each step back onto the sides as written //
+			std::vector<BigInt128_t> Trace_UInt64Vec{ Closest.Theorem() };
+			if (InOptionsRef.SearchStrategy == SearchStrategy_EnumClass::BestFirst || bResumeFlag)
+			{
+				const std::size_t TheoremSwap_UInt64 = !bGoalSetFlag && Subnets_UInt64Vec[LHS] < Subnets_UInt64Vec[RHS] ? 0x02 : 0x00;
+				for (std::size_t i = ProofStackUInt64; i + 1 < Trace_UInt64Vec.size(); i += 2)
+				{
+					const std::vector<BigInt128_t>& Axiom_UInt64Vec = WrittenAxioms_UInt64Vec[static_cast<std::size_t>(Trace_UInt64Vec[i + 1]) - 1];
+					const std::size_t AxiomSwap_UInt64 = Axiom_UInt64Vec[LHS] < Axiom_UInt64Vec[RHS] ? 0x01 : 0x00;
+					Trace_UInt64Vec[i] = static_cast<std::size_t>(Trace_UInt64Vec[i]) ^ TheoremSwap_UInt64 ^ AxiomSwap_UInt64;
+				}
+			}
+			Trace_UInt64Vec = ToLibraryGuids(std::move(Trace_UInt64Vec));
+
+			// Replace the failed verifications with the closest node's trace, cut at its first step that does not replay //
+			OutProofStepStdStrVecRef.clear();
+			OutAxiomCommitLogStdStrVecRef.clear();
+			const std::size_t Target_UInt64 = static_cast<std::size_t>(Trace_UInt64Vec[guid_UInt64]);
+			if (!ProofVerified(Trace_UInt64Vec, TargetTheoremsStdStrVec[Target_UInt64], InAxiomsStdStrVec, OutProofStepStdStrVecRef, OutAxiomCommitLogStdStrVecRef))
+			{
+				OutProofStepStdStrVecRef.pop_back();
+				OutAxiomCommitLogStdStrVecRef.back().pop_back();
+			}
+
+			if (OutAxiomCommitLogStdStrVecRef.back().empty())
+			{
+				OutProofStepStdStrVecRef.clear();
+				OutAxiomCommitLogStdStrVecRef.clear();
+				return;
+			}
+
+			OutRemainingDistance_UInt64Ref = TokenDistance(OutProofStepStdStrVecRef.back());
+			__stdlog__({ "Partial Proof Found: ", std::to_string(OutAxiomCommitLogStdStrVecRef.back().size()), " steps, ", std::to_string(OutRemainingDistance_UInt64Ref), " tokens from a proof" });
+		};
+
+		// File a solved theorem's proof in the cache and the ProofStore: under the strategy's objective, and, as a shortest or cheapest proof
+		// is a proof all the same, under that of every other strategy //
+		auto RecordProof = [&](const std::vector<BigInt128_t>& InProofRef) -> void
+		{
+			if (bGoalSetFlag)
+				return;
+
+			for (const std::uint64_t Key_UInt64 : { ProofKey_UInt64, InAxiomSetVersion_UInt64 })
+			{
+				if (InOptionsRef.bProofCacheFlag)
+					ProofCacheGlobal.Insert(Key_UInt64, Theorem_UInt64Vec[LHS], Theorem_UInt64Vec[RHS], InProofRef);
+
+				if (!InOptionsRef.ProofStoreDirectoryStdStr.empty())
+					OpenProofStore(InOptionsRef.ProofStoreDirectoryStdStr).Insert(InTheoremStdStrVec, Key_UInt64, InProofRef);
+
+				if (!bOptimalProofFlag)
+					break;
+			}
+		};
+
+		// Verify and record a proof found by one of the alternative engines; true once MaxAllowedProofs_UInt64 targets are reached //
+		auto OnProofFound = [&](const std::vector<BigInt128_t>& InTheoremRef) -> bool
+		{
+			const std::size_t Target_UInt64 = static_cast<std::size_t>(InTheoremRef[guid_UInt64]);
+			if (TargetReached(Target_UInt64))
+				return false;
+
+			const std::vector<BigInt128_t> Proof_UInt64Vec = ToLibraryGuids(InTheoremRef);
+			if (!ProofVerified(Proof_UInt64Vec, TargetTheoremsStdStrVec[Target_UInt64], InAxiomsStdStrVec, OutProofStepStdStrVecRef, OutAxiomCommitLogStdStrVecRef))
+				return false;
+
+			++TotalProofsFound_UInt64;
+			OutReachedTargetsRef.emplace_back(Target_UInt64);
+			RecordProof(Proof_UInt64Vec);
+
+			__stdlog__({ "Proof Found" });
+			return TotalProofsFound_UInt64 >= MaxAllowedProofs_UInt64;
+		};
+
+		// A completed system decides the theorem outright: the sides' normal forms either meet, in a proof, or differ, and none exists.
+		// It decides the axioms' equational theory, in which a lemma runs both ways: a library with lemmas is left to the search //
+		if (InOptionsRef.bCompletionFlag && !bResumeFlag && std::none_of(AxiomsStdStrVec.begin(), AxiomsStdStrVec.end(), DirectedAxiom))
+		{
+			const std::shared_ptr<const CompletedRewriteSystem> System = CompletedRewriteSystemOf(WrittenAxioms_UInt64Vec, InOptionsRef.CompletionBudget_UInt64);
+			const BigInt128_t LHSNormalForm = System->NormalForm(Subnets_UInt64Vec[LHS]);
+			bool bDecidedFlag = System->Complete();
+			for (std::size_t k = 1; k < Subnets_UInt64Vec.size() && TotalProofsFound_UInt64 < MaxAllowedProofs_UInt64; ++k)
+			{
+				if (!FeasibleTargetFlagVec[k - 1] || System->NormalForm(Subnets_UInt64Vec[k]) != LHSNormalForm)
+					continue;
+
+				// A normal-form derivation is neither shortest nor cheapest: such a strategy only learns here that a proof exists //
+				if (bOptimalProofFlag)
+				{
+					bDecidedFlag = false;
+					continue;
+				}
+
+				const std::size_t ProofSteps_UInt64 = OutProofStepStdStrVecRef.size();
+				const std::size_t CommitLogs_UInt64 = OutAxiomCommitLogStdStrVecRef.size();
+				const std::size_t Reached_UInt64 = OutReachedTargetsRef.size();
+				std::vector<BigInt128_t> Proof_UInt64Vec{ Subnets_UInt64Vec[LHS], Subnets_UInt64Vec[k], k - 1, 0 };
+				if
+					(
+						System->Derive(Subnets_UInt64Vec[LHS], InTheoremStdStrVec[LHS], AxiomsStdStrVec, 0x00, InOptionsRef.MaxDepth_UInt64, Proof_UInt64Vec) &&
+						System->Derive(Subnets_UInt64Vec[k], InTheoremStdStrVec[k], AxiomsStdStrVec, 0x02, InOptionsRef.MaxDepth_UInt64, Proof_UInt64Vec)
+					)
+				{
+					if (Proof_UInt64Vec.size() > ProofStackUInt64)
+						Proof_UInt64Vec[last_UInt64] = Proof_UInt64Vec.back();
+					OnProofFound(Proof_UInt64Vec);
+					if (OutReachedTargetsRef.size() > Reached_UInt64)
+						continue;
+				}
+
+				// Too long a derivation, or one whose steps do not replay on the token strings: the search takes this target //
+				OutProofStepStdStrVecRef.resize(ProofSteps_UInt64);
+				OutAxiomCommitLogStdStrVecRef.resize(CommitLogs_UInt64);
+				bDecidedFlag = false;
+			}
+
+			if (bDecidedFlag || TotalProofsFound_UInt64 >= MaxAllowedProofs_UInt64)
+			{
+				QED = TotalProofsFound_UInt64 > 0;
+				__stdlog__({ QED ? "Proof found by normalization" : "Unprovable: the sides' normal forms differ" });
+				__stdtraceout__("STDThreadProve\n");
+				OutProofFound_FlagRef = QED;
+				OutStatusReadyFlag = true; /* Set the Status Variable, last */
+				return true;
+			}
+		}
+
+		if (InOptionsRef.SearchStrategy != SearchStrategy_EnumClass::BestFirst && !bResumeFlag)
+		{
+			// The engines poll one abort flag: with a time budget, a watchdog raises it at the deadline.
+			// Suspend() leaves these engines running, as it has no checkpoint to write for them //
+			DeadlineWatchdog Watchdog{ InOptionsRef.TimeBudgetMilliseconds_UInt64, Start };
+			const std::atomic<bool>& DeadlineAbortFlag = Watchdog.AbortFlag;
+
+			if (InOptionsRef.SearchStrategy == SearchStrategy_EnumClass::Bidirectional)
+			{
+				// The shared LHS is not rebalanced, and the axioms are encoded as written, so the joined trace replays as is.
+				// Only the lattice-feasible targets are searched for; a meeting's guid slot is mapped back onto the goal set //
+				std::vector<BigInt128_t> Targets_UInt64Vec;
+				std::vector<std::size_t> TargetIndices_UInt64Vec;
+				for (std::size_t k = 1; k < Subnets_UInt64Vec.size(); ++k)
+				{
+					if (!FeasibleTargetFlagVec[k - 1])
+						continue;
+					Targets_UInt64Vec.emplace_back(Subnets_UInt64Vec[k]);
+					TargetIndices_UInt64Vec.emplace_back(k - 1);
+				}
+
+				// The closest pair of states, whose guid slot is mapped back in the same way //
+				ClosestNodeTracker Meeting{ SymbolPrimes_UInt64Vec };
+
+				__ProveBidirectional__
+				(
+					Subnets_UInt64Vec[LHS],
+					Targets_UInt64Vec,
+					WrittenAxioms_UInt64Vec,
+					[&](const std::vector<BigInt128_t>& InTheoremRef) -> bool
+					{
+						std::vector<BigInt128_t> Theorem_UInt64Vec{ InTheoremRef };
+						Theorem_UInt64Vec[guid_UInt64] = TargetIndices_UInt64Vec[static_cast<std::size_t>(InTheoremRef[guid_UInt64])];
+						return OnProofFound(Theorem_UInt64Vec);
+					},
+					InOptionsRef,
+					DeadlineAbortFlag,
+					ClosestPtr ? &Meeting : nullptr
+				);
+
+				if (!Meeting.empty())
+				{
+					std::vector<BigInt128_t> Theorem_UInt64Vec{ Meeting.Theorem() };
+					Theorem_UInt64Vec[guid_UInt64] = TargetIndices_UInt64Vec[static_cast<std::size_t>(Theorem_UInt64Vec[guid_UInt64])];
+					Closest.Offer(Theorem_UInt64Vec, Meeting.Distance());
+				}
+			} else {
+				// Roots and axioms as written: the token strings travel with each node, and decide every move //
+				std::vector<BoundedSearchNode_Struct> Roots;
+				for (std::size_t k = 1; k < Subnets_UInt64Vec.size(); ++k)
+					if (FeasibleTargetFlagVec[k - 1])
+						Roots.push_back({ { Subnets_UInt64Vec[LHS], Subnets_UInt64Vec[k], k - 1, 0 }, TargetTheoremsStdStrVec[k - 1] });
+
+				if (InOptionsRef.SearchStrategy == SearchStrategy_EnumClass::IDAStar)
+					__ProveIDAStar__(Roots, WrittenAxioms_UInt64Vec, AxiomsStdStrVec, OnProofFound, InOptionsRef, DeadlineAbortFlag, ClosestPtr);
+				else if (InOptionsRef.SearchStrategy == SearchStrategy_EnumClass::Beam)
+					__ProveBeam__(Roots, WrittenAxioms_UInt64Vec, AxiomsStdStrVec, OnProofFound, InOptionsRef, DeadlineAbortFlag, ClosestPtr);
+				else if (InOptionsRef.SearchStrategy == SearchStrategy_EnumClass::BreadthFirst)
+					__ProveLevelSynchronous__(Roots, WrittenAxioms_UInt64Vec, AxiomsStdStrVec, OnProofFound, InOptionsRef, DeadlineAbortFlag, nullptr, ClosestPtr);
+				else if (InOptionsRef.SearchStrategy == SearchStrategy_EnumClass::EqualitySaturation)
+					__ProveEqualitySaturation__(Roots, WrittenAxioms_UInt64Vec, AxiomsStdStrVec, OnProofFound, InOptionsRef, DeadlineAbortFlag, ClosestPtr);
+				else
+					__ProveMinimumCost__(Roots, WrittenAxioms_UInt64Vec, AxiomsStdStrVec, AxiomCosts_UInt64Vec, OnProofFound, InOptionsRef, DeadlineAbortFlag, ClosestPtr);
+			}
+			Watchdog.Stop();
+
+			QED = TotalProofsFound_UInt64 > 0;
+			if (!QED)
+				ReturnPartialProof();
+
+			__stdtraceout__("STDThreadProve\n");
+			OutProofFound_FlagRef = QED;
+			OutStatusReadyFlag = true; /* Set the Status Variable, last */
+			return true;
+		}
+
+		// Overflow rewrites beyond InOptionsRef.StandbyThreshold_UInt64 are deferred here, and reclaimed once Tasks_Thread runs dry //
+		StandbyRewriteThread StandbyTasks_Thread;
+		std::vector<std::vector<BigInt128_t>> ClosedStates;
+
+		// Moves that undo, take a longer route to, or merely reorder the node's last step are never generated //
+		// Learned macro-axioms follow the library's axioms as moves; each expands, for a reduce and an expand move, into its steps' (opcode, guid) //
+		std::vector<std::vector<BigInt128_t>> MacroAxioms_UInt64Vec;
+		std::vector<std::array<std::vector<std::pair<std::size_t, std::size_t>>, 2>> MacroExpansions;
+		if (InMacrosPtr && InOptionsRef.bMacroOperatorsFlag)
+		{
+			const std::vector<MacroOperators::Compiled_Struct> Compiled = InMacrosPtr->Compile
+			(
+				WrittenAxioms_UInt64Vec,
+				[&](const std::size_t InAxiom_UInt64) -> std::size_t
+				{
+					if (InAxiom_UInt64 >= InAxiomsStdStrVec.size())
+						return std::string::npos;
+					return !bSlicedFlag ? InAxiom_UInt64 : CompactGuid_UInt64Vec[InAxiom_UInt64 + 1] ? CompactGuid_UInt64Vec[InAxiom_UInt64 + 1] - 1 : std::string::npos;
+				}
+			);
+			if (!Compiled.empty())
+				MacroAxioms_UInt64Vec = Axioms_UInt64Vec;
+			for (const MacroOperators::Compiled_Struct& Macro : Compiled)
+			{
+				// Each step as the rebalanced axiom runs it: forward (a reduce) unless the axiom was swapped //
+				std::array<std::vector<std::pair<std::size_t, std::size_t>>, 2> Expansion;
+				for (const MacroOperators::Step_Struct& Step : Macro.Steps)
+				{
+					const std::vector<BigInt128_t>& Axiom_UInt64Vec = WrittenAxioms_UInt64Vec[Step.Axiom_UInt64];
+					const bool bRebalancedFlag = Axiom_UInt64Vec[LHS] < Axiom_UInt64Vec[RHS];
+					Expansion[0].emplace_back(Step.bForwardFlag != bRebalancedFlag ? 0x00 : 0x01, Step.Axiom_UInt64 + 1);
+					Expansion[1].emplace(Expansion[1].begin(), Step.bForwardFlag != bRebalancedFlag ? 0x01 : 0x00, Step.Axiom_UInt64 + 1);
+				}
+
+				// The macro is rebalanced as its axioms are: the larger composite as LHS; one through a lemma is directed as the lemma is //
+				const bool bRebalancedFlag = Macro.LHS < Macro.RHS;
+				MacroAxioms_UInt64Vec.push_back({ bRebalancedFlag ? Macro.RHS : Macro.LHS, bRebalancedFlag ? Macro.LHS : Macro.RHS, MacroAxioms_UInt64Vec.size() + 1 });
+				if (std::any_of(Macro.Steps.begin(), Macro.Steps.end(), [&](const MacroOperators::Step_Struct& InStepRef) { return DirectedAxiom(AxiomsStdStrVec[InStepRef.Axiom_UInt64]); }))
+					MacroAxioms_UInt64Vec.back().emplace_back(bRebalancedFlag ? 0x01 : 0x00);
+				if (bRebalancedFlag)
+					std::swap(Expansion[0], Expansion[1]);
+				MacroExpansions.emplace_back(std::move(Expansion));
+			}
+			__stdlog__({ std::to_string(MacroExpansions.size()), " macro-axioms" });
+		}
+		const std::vector<std::vector<BigInt128_t>>& SearchAxioms_UInt64Vec = MacroExpansions.empty() ? Axioms_UInt64Vec : MacroAxioms_UInt64Vec;
+
+		const std::shared_ptr<const MovePruningTable> Pruning = InOptionsRef.bMovePruningFlag ? MovePruningTableOf(SearchAxioms_UInt64Vec) : nullptr;
+
+		// Each rewrite proves a state equal to its parent: the states are unioned as they are generated, so the sides can meet at any state, expanded or not //
+		std::optional<EGraph> StateUnion;
+		std::vector<std::size_t> UnionRoot_UInt64Vec;
+		// The feasible targets not yet explained (as indices into UnionRoot_UInt64Vec), by the class they are in //
+		std::unordered_map<std::size_t, std::vector<std::size_t>> UnionTargets_UInt64Map;
+		if (InOptionsRef.bStateUnionFlag)
+		{
+			StateUnion.emplace();
+			for (const BigInt128_t& Subnet_UInt64 : Subnets_UInt64Vec)
+				UnionRoot_UInt64Vec.emplace_back(StateUnion->Add(Subnet_UInt64).first);
+			for (std::size_t k = 1; k < UnionRoot_UInt64Vec.size(); ++k)
+				if (FeasibleTargetFlagVec[k - 1])
+					UnionTargets_UInt64Map[StateUnion->Find(UnionRoot_UInt64Vec[k])].emplace_back(k);
+		}
+
+		// Rewrite InOutStateRef by the proof step (InOpcode_UInt64, InGuid_UInt64), and union the two states; true once MaxAllowedProofs_UInt64 targets are reached //
+		auto UnionStates = [&](BigInt128_t& InOutStateRef, const std::size_t InOpcode_UInt64, const std::size_t InGuid_UInt64) -> bool
+		{
+			// The step runs a rebalanced axiom: its direction as written is the one whose LHS it rewrites //
+			const std::size_t Axiom_UInt64 = InGuid_UInt64 - 1;
+			const BigInt128_t& From = Axioms_UInt64Vec[Axiom_UInt64][InOpcode_UInt64 & 0x01 ? RHS : LHS];
+			const std::size_t Parent_UInt64 = StateUnion->Add(InOutStateRef).first;
+			InOutStateRef = InOutStateRef / From * Axioms_UInt64Vec[Axiom_UInt64][InOpcode_UInt64 & 0x01 ? LHS : RHS];
+			const std::size_t Child_UInt64 = StateUnion->Add(InOutStateRef).first;
+			const std::size_t ParentClass_UInt64 = StateUnion->Find(Parent_UInt64);
+			const std::size_t ChildClass_UInt64 = StateUnion->Find(Child_UInt64);
+			if (!StateUnion->Merge(Parent_UInt64, Child_UInt64, { Axiom_UInt64, From == WrittenAxioms_UInt64Vec[Axiom_UInt64][LHS] }))
+				return false;
+
+			// Only the targets of the two classes merged can have joined the LHS's: their lists move to the merged class, the smaller into the larger //
+			std::vector<std::size_t> Targets_UInt64Vec;
+			for (const std::size_t Class_UInt64 : { ParentClass_UInt64, ChildClass_UInt64 })
+			{
+				auto Node = UnionTargets_UInt64Map.extract(Class_UInt64);
+				if (Node.empty())
+					continue;
+				if (Targets_UInt64Vec.size() < Node.mapped().size())
+					std::swap(Targets_UInt64Vec, Node.mapped());
+				Targets_UInt64Vec.insert(Targets_UInt64Vec.end(), Node.mapped().begin(), Node.mapped().end());
+			}
+			if (Targets_UInt64Vec.empty())
+				return false;
+			if (StateUnion->Find(Parent_UInt64) != StateUnion->Find(UnionRoot_UInt64Vec[LHS]))
+			{
+				UnionTargets_UInt64Map.emplace(StateUnion->Find(Parent_UInt64), std::move(Targets_UInt64Vec));
+				return false;
+			}
+
+			// A target is explained once, when it first joins the LHS's class: its proof path does not change thereafter //
+			std::sort(Targets_UInt64Vec.begin(), Targets_UInt64Vec.end());
+			for (const std::size_t k : Targets_UInt64Vec)
+			{
+				std::vector<BigInt128_t> Proof_UInt64Vec{ Subnets_UInt64Vec[LHS], Subnets_UInt64Vec[k], k - 1, 0 };
+				if (!ExplainedTheorem(StateUnion->Explain(UnionRoot_UInt64Vec[LHS], UnionRoot_UInt64Vec[k]), TargetTheoremsStdStrVec[k - 1], AxiomsStdStrVec, Proof_UInt64Vec))
+				{
+					__stdlog__({ "The union of target ", std::to_string(k - 1), " with the LHS does not replay on the tokens" });
+					continue;
+				}
+				__stdlog__({ "Proof found via the state union" });
+				if (OnProofFound(Proof_UInt64Vec))
+					return true;
+			}
+			return false;
+		};
+
+		// *** Core Proof Engine (Loop) *** //
+
+		while (( !Tasks_Thread.empty() || !FastForwardTask_Thread.empty() || StandbyTasks_Thread.Reclaim(Tasks_Thread, ClosedStates) ) && !QED && !bTimeoutFlag)
+		{
+			if (DeadlinePassed())
+			{
+				__stdlog__({ "Time budget spent" });
+				bTimeoutFlag = true;
+				break;
+			}
+
+			if (InOutCheckpointRef.SuspendRequestFlag)
+			{
+				StandbyTasks_Thread.Reclaim(Tasks_Thread, ClosedStates);
+				InOutCheckpointRef.SuspendedFlag = WriteCheckpoint();
+				break;
+			}
+
+			const std::vector<BigInt128_t>
+				Theorem{ !bFastForwardFlag ? Tasks_Thread.top() : FastForwardTask_Thread.top() };
+
+			!bFastForwardFlag ? Tasks_Thread.pop() : FastForwardTask_Thread.pop();
+
+			bFastForwardFlag = false;
+
+			// Routes toward a goal-set target already proven are dropped //
+			if (bGoalSetFlag && TargetReached(Theorem[guid_UInt64]))
+				continue;
+
+			if (StandbyTasks_Thread.pending())
+				ClosedStates.emplace_back(Theorem);
+
+			if (ClosestPtr && Theorem.size() > ProofStackUInt64)
+				Closest.Offer(Theorem, Closest.Distance(Theorem[LHS], Theorem[RHS]));
+
+			// Check rewrite proofs in the task queue //
+			const bool TentativeProofFound_Flag = ( Theorem[LHS] == Theorem[RHS] );
+
+			if (TentativeProofFound_Flag)
+			{
+				/**
+				Alright, we have successfully employed prime number fields
+				to effectively and swiftly reduce the size of our potential solution set.
+
+				Now, our next step is to confirm that this narrowed down solution space
+				indeed leads us to a valid routing map...
+				*/
+
+				__stdlog__({ "Tentative Proof Found" });
+				__stdlog__({ "Theorem {", Theorem[LHS].str(), ", ", Theorem[RHS].str(), "} " });
+
+				const std::size_t Target_UInt64 = static_cast<std::size_t>(Theorem[guid_UInt64]);
+
+				const std::vector<BigInt128_t> Proof_UInt64Vec = ToLibraryGuids(Theorem);
+
+				bool ProofFoundFlag{ true };
+
+				TempProofSteps.emplace_back(InTheoremStdStrVec);
+
+				//QED = true;
+				//break;
+
+				if 
+					(
+						ProofVerified
+						(
+							Proof_UInt64Vec,
+							TargetTheoremsStdStrVec[Target_UInt64],
+							InAxiomsStdStrVec,
+							OutProofStepStdStrVecRef,
+							OutAxiomCommitLogStdStrVecRef
+						)
+					)
+				{
+					++TotalProofsFound_UInt64;
+
+					OutReachedTargetsRef.emplace_back(Target_UInt64);
+					RecordProof(Proof_UInt64Vec);
+
+					__stdlog__({ "Proof Found" });
+					__stdlog__({ "Theorem {", Theorem[LHS].str(), ", ", Theorem[RHS].str(), "}\n" });
+
+					if (TotalProofsFound_UInt64 >= MaxAllowedProofs_UInt64)
+					{
+						QED = true;
+						break;
+					}
+				} else {
+					// Retain Partial-proof //
+					continue;
+				}
+
+			} else {
+
+				// Add new rewrites to the task queue: Module_0000 (lhs_reduce), Module_0001 (lhs_expand), Module_0002 (rhs_reduce), Module_0003 (rhs_expand) //
+				ExpandTheorem
+				(
+					Theorem,
+					SearchAxioms_UInt64Vec,
+					[&](std::vector<BigInt128_t>&& InTheorem_iRef, const std::size_t InMove_UInt64) -> bool
+					{
+						static constexpr const char* ModuleStdStr[] = { "lhs_reduce in Module_0000", "lhs_expand in Module_0001", "rhs_reduce in Module_0002", "rhs_expand in Module_0003" };
+						const std::size_t opcode = InMove_UInt64 % 4;
+						const int Side = opcode < 0x02 ? LHS : RHS;
+						const int OtherSide = opcode < 0x02 ? RHS : LHS;
+						auto& RouteHistoryMap = opcode < 0x02 ? LHSRouteHistoryMap : RHSRouteHistoryMap;
+						auto& OtherRouteHistoryMap = opcode < 0x02 ? RHSRouteHistoryMap : LHSRouteHistoryMap;
+						__stdlog__({ ModuleStdStr[opcode], " via Axiom_", InTheorem_iRef[last_UInt64].str(), " {", InTheorem_iRef[LHS].str(), ", ", InTheorem_iRef[RHS].str(), "}" });
+
+						// A macro move is recorded as the steps it compiles //
+						if (const std::size_t Axiom_UInt64 = InMove_UInt64 / 4; Axiom_UInt64 >= Axioms_UInt64Vec.size())
+						{
+							InTheorem_iRef.resize(Theorem.size());
+							for (const auto& [Direction_UInt64, Guid_UInt64] : MacroExpansions[Axiom_UInt64 - Axioms_UInt64Vec.size()][opcode & 0x01])
+							{
+								InTheorem_iRef.emplace_back(( opcode & 0x02 ) | Direction_UInt64);
+								InTheorem_iRef.emplace_back(Guid_UInt64);
+							}
+							InTheorem_iRef[last_UInt64] = InTheorem_iRef.back();
+						}
+
+						// Every step unions its state with the state before it //
+						BigInt128_t State{ Theorem[Side] };
+						for (std::size_t i = Theorem.size(); StateUnion && i + 1 < InTheorem_iRef.size(); i += 2)
+						{
+							if (UnionStates(State, static_cast<std::size_t>(InTheorem_iRef[i]), static_cast<std::size_t>(InTheorem_iRef[i + 1])))
+							{
+								QED = true;
+								return false;
+							}
+						}
+
+						// Commit for later fast-forward //
+						if (RouteHistoryMap.find(InTheorem_iRef[Side]) == RouteHistoryMap.end())
+							RouteHistoryMap.emplace(InTheorem_iRef[Side], InTheorem_iRef);
+
+						// Attempt fast-forward; an LHS rewrite reaches the goal-set target of the RHS route it meets //
+						if (const auto route = OtherRouteHistoryMap.find(InTheorem_iRef[Side]); route != OtherRouteHistoryMap.end() &&
+							!TargetReached(Side == LHS ? route->second[guid_UInt64] : InTheorem_iRef[guid_UInt64]))
+						{
+							__stdlog__({ "Proof found in ", ModuleStdStr[opcode] + 14, " via Fast-Forward (FF)" });
+							InTheorem_iRef.insert(InTheorem_iRef.end(), route->second.begin() + ProofStackUInt64, route->second.end());
+							InTheorem_iRef[OtherSide] = InTheorem_iRef[Side];
+							if (Side == LHS)
+								InTheorem_iRef[guid_UInt64] = route->second[guid_UInt64]; // The goal-set target reached //
+
+							// Is the FF queue still empty? //
+							if (FastForwardTask_Thread.empty()) {
+								bFastForwardFlag = true;
+								FastForwardTask_Thread.push(InTheorem_iRef);
+								return false;
+							}
+						}
+						Tasks_Thread.push(InTheorem_iRef);
+						return true;
+					},
+					0,
+					Pruning.get()
+				);
+
+				// Keep the primary frontier bounded: hand its least promising half to the standby thread //
+				if (InOptionsRef.StandbyThreshold_UInt64 && Tasks_Thread.size() > InOptionsRef.StandbyThreshold_UInt64)
+				{
+					StandbyTasks_Thread.Defer
+					(
+						Tasks_Thread.EvictColdest(Tasks_Thread.size() - InOptionsRef.StandbyThreshold_UInt64 / 2),
+						ClosedStates
+					);
+				}
+			} // end test (...Theorem[LHS] == Theorem[RHS])
+		} // end for (...!Tasks_Thread.empty() && !QED))
+
+		//*** End: Core Proof Engine (Loop) *** //
+
+		/*if (!QED)
+		{
+			if (TempProofSteps.size())
+			{
+				__stdlog__({ "Partial Proof Found." });
+			} else {
+				__stdlog__({ "No Proof Found." });
+			}
+		}*/
+
+		if (!TotalProofsFound_UInt64 && !InOutCheckpointRef.SuspendedFlag)
+			ReturnPartialProof();
+
+		__stdtraceout__("STDThreadProve\n");
+
+		OutProofFound_FlagRef = QED;
+
+		//print_path(OutProofStepStdStrVecRef);
+
+		OutStatusReadyFlag = true; /* Set the Status Variable, last */
+
+		return true;
+	}
+
+	/**
+	 * __ProveShared__ : Solve several theorems which share an LHS in one combined exploration.
+	 * The shared LHS is rewritten forward, breadth-first, and every token state is expanded at most once;
+	 * its prime composite screens each axiom (divisibility) before the token rewrite, and is looked up in a
+	 * hash map of all pending RHS targets. A theorem completes as soon as its target is reached, while the
+	 * exploration continues for the rest, until no target remains, the reachable states are exhausted,
+	 * InOptionsRef.StateLimit_UInt64 distinct states have been seen, or InAbortFlagRef is raised.
+	 * OutResultsRef[i] receives the outcome of InTheoremsStdStrVec[i].
+	*/
+	void __ProveShared__
+	(
+		const
+		std::span<
+		const
+		std::vector<
+		std::vector<
+		std::string>>>
+		InTheoremsStdStrVec,
+
+		const
+		std::vector<
+		std::vector<
+		std::vector<
+		std::string>>>&
+		InAxiomsStdStrVec,
+
+		std::vector<
+		ProofResult_Struct>&
+		OutResultsRef,
+
+		const
+		ProofSearchOptions_Struct&
+		InOptionsRef,
+
+		const
+		std::atomic<bool>&
+		InAbortFlagRef
+	)
+	{
+		__stdtracein__("__ProveShared__");
+
+		constexpr int LHS = 0;
+		constexpr int RHS = 1;
+
+		OutResultsRef.assign(InTheoremsStdStrVec.size(), ProofResult_Struct{});
+		if (InTheoremsStdStrVec.empty())
+		{
+			__stdtraceout__("__ProveShared__");
+			return;
+		}
+
+		// Every symbol has been registered by the caller, so encoding only reads the symbol table //
+		auto Encode = [](const std::vector<std::string>& InExpressionStdStrVec) -> BigInt128_t
+		{
+			BigInt128_t PrimeProduct_UInt64{ 1 };
+			for (const std::string& Symbol_StdStr : InExpressionStdStrVec)
+			{
+				const auto& it = SymbolToPrime_UInt64MultiMap.find(Symbol_StdStr);
+				if (it != SymbolToPrime_UInt64MultiMap.end())
+					PrimeProduct_UInt64 *= it->second;
+			}
+			return PrimeProduct_UInt64;
+		};
+
+		// Axioms as written (not rebalanced), since the opcodes are replayed by ProofVerified //
+		std::vector<std::vector<BigInt128_t>> Axioms_UInt64Vec;
+		for (const std::vector<std::vector<std::string>>& Subnet_StdStrVec : InAxiomsStdStrVec)
+		{
+			// A removed (or offline) axiom is left empty, and never moved by //
+			if (Subnet_StdStrVec.size() < 2)
+				Axioms_UInt64Vec.emplace_back();
+			else
+				Axioms_UInt64Vec.push_back({ Encode(Subnet_StdStrVec[LHS]), Encode(Subnet_StdStrVec[RHS]) });
+		}
+
+		std::unordered_map<BigInt128_t, std::vector<std::size_t>> PendingTargets;
+		for (std::size_t i = 0; i < InTheoremsStdStrVec.size(); ++i)
+			PendingTargets[Encode(InTheoremsStdStrVec[i][RHS])].emplace_back(i);
+
+		struct SharedNode_Struct
+		{
+			BigInt128_t Composite;
+			std::vector<std::string> LHSStdStrVec;
+			std::vector<BigInt128_t> ProofStack_UInt64Vec;
+		};
+
+		std::unordered_set<std::string> ClosedStates;
+		std::queue<SharedNode_Struct> Tasks_Thread;
+
+		const std::vector<std::string>& SharedLHS_StdStrVec = InTheoremsStdStrVec[0][LHS];
+		ClosedStates.emplace(TheoremTokenKey({ SharedLHS_StdStrVec }));
+		Tasks_Thread.push({ Encode(SharedLHS_StdStrVec), SharedLHS_StdStrVec, {} });
+
+		while (!Tasks_Thread.empty() && !PendingTargets.empty() && !InAbortFlagRef)
+		{
+			if (InOptionsRef.StateLimit_UInt64 && ClosedStates.size() >= InOptionsRef.StateLimit_UInt64)
+				break;
+
+			const SharedNode_Struct Node{ std::move(Tasks_Thread.front()) };
+			Tasks_Thread.pop();
+
+			const auto it = PendingTargets.find(Node.Composite);
+			if (it != PendingTargets.end())
+			{
+				std::vector<std::size_t>& Indices = it->second;
+				for (auto Index = Indices.begin(); Index != Indices.end(); )
+				{
+					if (Node.LHSStdStrVec != InTheoremsStdStrVec[*Index][RHS])
+					{
+						++Index;
+						continue;
+					}
+
+					ProofResult_Struct& Result = OutResultsRef[*Index];
+					std::vector<BigInt128_t> Theorem{ Node.Composite, Node.Composite, 0, 0 };
+					Theorem.insert(Theorem.end(), Node.ProofStack_UInt64Vec.begin(), Node.ProofStack_UInt64Vec.end());
+					Result.ProofFoundFlag = ProofVerified(Theorem, InTheoremsStdStrVec[*Index], InAxiomsStdStrVec, Result.ProofStep3DStdStrVec, Result.AxiomCommitLogStdStrVec);
+					// Each theorem here has the one target, index 0 //
+					if (Result.ProofFoundFlag)
+						Result.ReachedTargetIndices.emplace_back(0);
+					__stdlog__({ "Proof Found (shared) for theorem ", std::to_string(*Index) });
+					Index = Indices.erase(Index);
+				}
+				if (Indices.empty())
+					PendingTargets.erase(it);
+			}
+
+			for (std::size_t a = 0; a < Axioms_UInt64Vec.size(); ++a)
+			{
+				if (Axioms_UInt64Vec[a].empty())
+					continue;
+
+				// lhs_reduce (0x00) rewrites the axiom's LHS to its RHS, lhs_expand (0x01) its RHS to its LHS //
+				for (const std::size_t opcode : { std::size_t{ 0x00 }, std::size_t{ 0x01 } })
+				{
+					const BigInt128_t& From = Axioms_UInt64Vec[a][opcode];
+					const BigInt128_t& To = Axioms_UInt64Vec[a][opcode ^ 1];
+					if (( opcode && DirectedAxiom(InAxiomsStdStrVec[a]) ) || Node.Composite % From != 0)
+						continue;
+
+					std::vector<std::string> LHS_StdStrVec{ Node.LHSStdStrVec };
+					if (!Rewrite(LHS_StdStrVec, InAxiomsStdStrVec[a][opcode], InAxiomsStdStrVec[a][opcode ^ 1]))
+						continue;
+					if (!ClosedStates.emplace(TheoremTokenKey({ LHS_StdStrVec })).second)
+						continue;
+
+					std::vector<BigInt128_t> ProofStack_UInt64Vec{ Node.ProofStack_UInt64Vec };
+					ProofStack_UInt64Vec.emplace_back(opcode);
+					ProofStack_UInt64Vec.emplace_back(a + 1); // guid //
+					Tasks_Thread.push({ Node.Composite / From * To, std::move(LHS_StdStrVec), std::move(ProofStack_UInt64Vec) });
+				}
+			}
+		}
+
+		__stdtraceout__("__ProveShared__");
+	}
+
+	enum class /*API_EXPORT*/ BracketType { CurlyBraces, SquareBrackets, Parentheses };
 
 	template <BracketType type>
 	struct BracketTraits {};
 
-	template <>
-	struct BracketTraits<BracketType::CurlyBraces>
-	{
-		static constexpr std::string Open = "{";
-		static constexpr std::string Close = "}";
-	};
+	template <>
+	struct BracketTraits<BracketType::CurlyBraces>
+	{
+		static constexpr std::string Open = "{";
+		static constexpr std::string Close = "}";
+	};
+
+	template <>
+	struct BracketTraits<BracketType::SquareBrackets>
+	{
+		static constexpr std::string Open = "[";
+		static constexpr std::string Close = "]";
+	};
+
+	template <>
+	struct BracketTraits<BracketType::Parentheses>
+	{
+		static constexpr std::string Open = "(";
+		static constexpr std::string Close = ")";
+	};
+
+	class /*API_EXPORT*/ CurlyBraceElide
+	{
+	public:
+		/**
+		Usage Example:
+		std::vector<std::string> input = { "{", "{", "{", "1", "}", "}", "+", "{", "{", "1", "}", "}", "}", "=", "{", "{", "2", "}", "}" };
+		const auto& output = CurlyBraceElide::Elide<BracketType::CurlyBraces>(input); // { "{", "1", "}", "+", "{", "1", "}", "=", "{", "2", "}" }
+		*/
+		template <BracketType type>
+		static std::vector<std::string> Elide(const std::vector<std::string>& input)
+		{
+			static_assert( std::is_same_v<decltype( type ), BracketType>, "Invalid bracket type" );
+			const std::string& openBrace = BracketTraits<type>::Open;
+			const std::string& closeBrace = BracketTraits<type>::Close;
+			std::vector<std::string> output;
+			bool OpenScopeFlag = false;
+			for (const std::string& c : input)
+			{
+				if (c == openBrace)
+				{
+					if (!OpenScopeFlag)
+					{
+						output.push_back(openBrace);
+						OpenScopeFlag = true;
+					}
+					continue;
+				} else if (c == closeBrace)
+				{
+					if (OpenScopeFlag)
+					{
+						output.push_back(closeBrace);
+						OpenScopeFlag = false;
+					}
+					continue;
+				}
+				output.push_back(c);
+			}
+			return output;
+		}
+		/**
+		Usage Example:
+		const auto& output = CurlyBraceElide::Elide<BracketType::CurlyBraces>
+		(
+			{
+				"{", "{", "{", "1", "}", "}", "+", "{", "{", "1", "}", "}", "}", "=", "{", "{", "2", "}", "}"
+			}
+		); // Output: { "{", "1", "}", "+", "{", "1", "}", "=", "{", "2", "}" }
+		*/
+		template <BracketType type>
+		static std::vector<std::string> Elide(const std::initializer_list<std::string>& input)
+		{
+			static_assert( std::is_same_v<decltype( type ), BracketType>, "Invalid bracket type" );
+			const std::vector<std::string>& input2(input);
+			return Elide<type>(input2);
+		}
+	};
+
+	template<BracketType EuclidBracket>
+	class /*API_EXPORT*/ EuclidProver;
+
+	template<>
+	class /*API_EXPORT*/ EuclidProver<BracketType::CurlyBraces>
+	{
+	public:
+		explicit EuclidProver
+		(
+			const std::string openBrace = "{",
+			const std::string closeBrace = "}"
+		) noexcept :
+			_openBrace{ openBrace },
+			_openBraceST{ "st" + openBrace },
+			_closeBrace{ closeBrace }
+		{
+
+		}
+
+		bool ProofFoundFlag{};
+		bool StatusReadyFlag{};
+
+		std::vector<
+			std::vector<
+			std::vector<
+			std::string>>>
+			ProofStep3DStdStrVec;
+
+		std::vector<
+			std::vector<
+			std::string>>
+			AxiomCommitLogStdStrVecRef;
+
+		// Goal-set targets reached by the last Prove() (0: the first RHS) //
+		std::vector<std::size_t> ReachedTargetIndices;
+
+		// Tokens left unmatched between LHS and RHS by the last step of a partial proof //
+		std::size_t RemainingDistance_UInt64{};
+
+		// Axioms the last Prove() sliced away, unreachable from its theorem's symbols //
+		std::size_t SlicedAxioms_UInt64{};
+
+		// The current axioms' dependency graph, analysed on load: RewriteGraph.CyclicClusters() lists the axioms in rewrite cycles //
+		AxiomRewriteGraph RewriteGraph{};
+
+		// Macro-axioms learned for the current axioms (see LearnMacros) //
+		MacroOperators Macros{};
+
+		bool Axiom
+		(
+			const
+			std::vector<
+			std::string>&
+			InAxiomConstStdStrVecRef
+		)
+		{
+			return true;
+		}
+
+		bool Axiom
+		(
+			const
+			std::initializer_list<
+			std::string>&
+			InAxiomInitListConstStdStringRef
+		)
+		{
+			const std::vector<std::string>& InAxiomVecConstStdStringRef{ InAxiomInitListConstStdStringRef };
+			return Axiom(InAxiomVecConstStdStringRef);
+		}
+
+		bool Axioms
+		(
+			const
+			std::vector<
+			std::vector<
+			std::vector<
+			std::string>>>&
+			InAxiomsConstStdStrVec
+		)
+		{
+			__stdtracein__("Axioms");
+
+			// The symbol table is extended below; wait out any in-flight Prove() //
+			if (th.valid())
+				th.get();
+
+			// The lemmas outlive the axioms they were declared with, and follow the new ones //
+			std::vector<std::vector<std::vector<std::string>>> LemmasStdStrVec;
+			for (const std::size_t Lemma_UInt64 : LemmaSlots_UInt64Vec)
+				LemmasStdStrVec.emplace_back(DeclaredAxiomsStdStrVec[Lemma_UInt64]);
+
+			DeclaredAxiomsStdStrVec.clear();
+			AxiomOnlineFlagVec.clear();
+			LemmaSlots_UInt64Vec.clear();
+			for (const std::vector<std::vector<std::string>>& Axiom_StdStrVec : InAxiomsConstStdStrVec)
+				AppendSlot(Axiom_StdStrVec);
+			for (const std::vector<std::vector<std::string>>& Lemma_StdStrVec : LemmasStdStrVec)
+				LemmaSlots_UInt64Vec.emplace_back(AppendSlot(Lemma_StdStrVec));
+
+			AxiomCosts_UInt64Vec.clear();
+			CompileLibrary();
+			/*
+			{
+				{
+					{"1", "+", "1"}, // (lhs) Prime Composite: 8303 //
+					{"2"} // (rhs) Prime Composite: 31
+				},
+
+				{
+					{"2", "+", "2"}, // (lhs) Prime Composite: 22103 //
+					{"4"} // (rhs) Prime Composite: 29 //
+				}
+			};
+			*/
+
+			__stdtraceout__("Axioms");
+			return true;
+		}
+
+		bool Axioms
+		(
+			const
+			std::initializer_list<
+			std::vector<
+			std::vector<
+			std::string>>>& InAxiomInitListConstStdStringRef
+		)
+		{
+			const
+				std::vector<
+				std::vector<
+				std::vector<
+				std::string>>>&
+				TempInAxiomsConstStdStrVecRef{ InAxiomInitListConstStdStringRef };
+
+			return Axioms(TempInAxiomsConstStdStrVecRef);
+		}
+
+		/**
+		Axioms() : As above, with a non-negative cost per axiom (in axiom order; axioms without one cost 1),
+		minimized by the MinimumCost strategy.
+		usage: ep.Axioms({ { {"1", "+", "1"}, {"2"} }, { {"2", "+", "2"}, {"4"} } }, { 1, 5 });
+		*/
+		bool Axioms
+		(
+			const
+			std::vector<
+			std::vector<
+			std::vector<
+			std::string>>>&
+			InAxiomsConstStdStrVec,
+
+			const
+			std::vector<
+			std::uint64_t>&
+			InAxiomCosts_UInt64Vec
+		)
+		{
+			Axioms(InAxiomsConstStdStrVec);
+			AxiomCosts_UInt64Vec = InAxiomCosts_UInt64Vec;
+			RehashLibrary();
+			return true;
+		}
+
+		/**
+		AddAxiom() : Add one axiom, { LHS, RHS }, online, under the id OutAxiomId_UInt64Ref - the index commit logs name it by
+		("lhs_reduce via Axiom_<id>") - which it keeps: ids are never reused, nor renumbered by a removal. Only the new axiom is
+		compiled through the lemmas, encoded and entered in the call graph; the rest of the library is left as it is.
+		Returns false, adding nothing, unless the axiom has two sides.
+		usage: std::size_t AxiomId_UInt64{}; ep.AddAxiom({ {"2", "+", "2"}, {"4"} }, AxiomId_UInt64);
+		*/
+		bool AddAxiom
+		(
+			const
+			std::vector<
+			std::vector<
+			std::string>>&
+			InAxiomStdStrVec,
+
+			std::size_t&
+			OutAxiomId_UInt64Ref
+		)
+		{
+			__stdtracein__("AddAxiom");
+
+			if (InAxiomStdStrVec.size() != 2)
+			{
+				__stdtraceout__("AddAxiom");
+				return false;
+			}
 
-	template <>
-	struct BracketTraits<BracketType::SquareBrackets>
-	{
-		static constexpr std::string Open = "[";
-		static constexpr std::string Close = "]";
-	};
+			// The symbol table is extended below; wait out any in-flight Prove() //
+			if (th.valid())
+				th.get();
 
-	template <>
-	struct BracketTraits<BracketType::Parentheses>
-	{
-		static constexpr std::string Open = "(";
-		static constexpr std::string Close = ")";
-	};
+			OutAxiomId_UInt64Ref = AppendSlot(InAxiomStdStrVec);
+			UpdateSlot(OutAxiomId_UInt64Ref);
+
+			__stdtraceout__("AddAxiom");
+			return true;
+		}
 
-	class /*API_EXPORT*/ CurlyBraceElide
-	{
-	public:
 		/**
-		Usage Example:
-		std::vector<std::string> input = { "{", "{", "{", "1", "}", "}", "+", "{", "{", "1", "}", "}", "}", "=", "{", "{", "2", "}", "}" };
-		const auto& output = CurlyBraceElide::Elide<BracketType::CurlyBraces>(input); // { "{", "1", "}", "+", "{", "1", "}", "=", "{", "2", "}" }
+		RemoveAxiom() : Remove the axiom, or lemma, InAxiomId_UInt64 from the library; every other id is unchanged.
+		As AddAxiom(), this touches the one axiom only - but for a lemma, whose removal recompiles the library through the rest.
+		Returns false for an id not in the library.
 		*/
-		template <BracketType type>
-		static std::vector<std::string> Elide(const std::vector<std::string>& input)
+		bool RemoveAxiom(const std::size_t InAxiomId_UInt64)
 		{
-			static_assert( std::is_same_v<decltype( type ), BracketType>, "Invalid bracket type" );
-			const std::string& openBrace = BracketTraits<type>::Open;
-			const std::string& closeBrace = BracketTraits<type>::Close;
-			std::vector<std::string> output;
-			bool OpenScopeFlag = false;
-			for (const std::string& c : input)
+			__stdtracein__("RemoveAxiom");
+
+			if (!AxiomSlot(InAxiomId_UInt64))
 			{
-				if (c == openBrace)
-				{
-					if (!OpenScopeFlag)
-					{
-						output.push_back(openBrace);
-						OpenScopeFlag = true;
-					}
-					continue;
-				} else if (c == closeBrace)
-				{
-					if (OpenScopeFlag)
-					{
-						output.push_back(closeBrace);
-						OpenScopeFlag = false;
-					}
-					continue;
-				}
-				output.push_back(c);
+				__stdtraceout__("RemoveAxiom");
+				return false;
 			}
-			return output;
+
+			if (th.valid())
+				th.get();
+
+			DeclaredAxiomsStdStrVec[InAxiomId_UInt64].clear();
+			if (LemmaSlot(InAxiomId_UInt64))
+			{
+				std::erase(LemmaSlots_UInt64Vec, InAxiomId_UInt64);
+				CompileLibrary();
+			}
+			else
+				UpdateSlot(InAxiomId_UInt64);
+
+			__stdtraceout__("RemoveAxiom");
+			return true;
 		}
+
 		/**
-		Usage Example:
-		const auto& output = CurlyBraceElide::Elide<BracketType::CurlyBraces>
-		(
+		SetAxiomOnline() : Take the axiom, or lemma, InAxiomId_UInt64 offline - hidden from every search, its id kept - or bring it
+		back online. Proofs cached while the library was last in the same state are found again (see RehashSlot).
+		Returns false for an id not in the library.
+		usage: ep.SetAxiomOnline(AxiomId_UInt64, false); // ... // ep.SetAxiomOnline(AxiomId_UInt64, true);
+		*/
+		bool SetAxiomOnline(const std::size_t InAxiomId_UInt64, const bool InOnlineFlag)
+		{
+			__stdtracein__("SetAxiomOnline");
+
+			if (!AxiomSlot(InAxiomId_UInt64))
 			{
-				"{", "{", "{", "1", "}", "}", "+", "{", "{", "1", "}", "}", "}", "=", "{", "{", "2", "}", "}"
+				__stdtraceout__("SetAxiomOnline");
+				return false;
 			}
-		); // Output: { "{", "1", "}", "+", "{", "1", "}", "=", "{", "2", "}" }
+
+			if (AxiomOnlineFlagVec[InAxiomId_UInt64] != InOnlineFlag)
+			{
+				if (th.valid())
+					th.get();
+
+				AxiomOnlineFlagVec[InAxiomId_UInt64] = InOnlineFlag;
+				if (LemmaSlot(InAxiomId_UInt64))
+					CompileLibrary();
+				else
+					UpdateSlot(InAxiomId_UInt64);
+			}
+
+			__stdtraceout__("SetAxiomOnline");
+			return true;
+		}
+
+		/**
+		Lemma() : Add a lemma, written as one token string around its arrow: { "X", "==>", "Y" } rewrites X into Y only,
+		{ "X", "<==", "Y" } Y into X only, and { "X", "<==>", "Y" } either way, as an axiom does. A directed lemma is kept
+		as a directed rule, { From, To, { "==>" } }, which the search only ever runs forward (see DirectedAxiom), and the
+		axioms are rewritten through it once, here (see Lemmas). Returns false, adding nothing, without exactly one arrow.
+		usage: ep.Lemma({ "1", "<==>", "1", "/", "1" });
 		*/
-		template <BracketType type>
-		static std::vector<std::string> Elide(const std::initializer_list<std::string>& input)
+		bool Lemma
+		(
+			const
+			std::vector<
+			std::string>&
+			InLemmaConstStdStringVecRef
+		)
 		{
-			static_assert( std::is_same_v<decltype( type ), BracketType>, "Invalid bracket type" );
-			const std::vector<std::string>& input2(input);
-			return Elide<type>(input2);
+			auto IsArrow = [](const std::string& InSymbolStdStr) -> bool { return InSymbolStdStr == "==>" || InSymbolStdStr == "<==" || InSymbolStdStr == "<==>"; };
+			const auto Arrow = std::find_if(InLemmaConstStdStringVecRef.begin(), InLemmaConstStdStringVecRef.end(), IsArrow);
+			if (Arrow == InLemmaConstStdStringVecRef.end() || std::any_of(Arrow + 1, InLemmaConstStdStringVecRef.end(), IsArrow))
+				return false;
+
+			if (th.valid())
+				th.get();
+
+			if (!AddLemma({ { InLemmaConstStdStringVecRef.begin(), Arrow }, { *Arrow }, { Arrow + 1, InLemmaConstStdStringVecRef.end() } }))
+				return false;
+			CompileLibrary();
+			return true;
 		}
-	};
 
-	template<BracketType EuclidBracket>
-	class /*API_EXPORT*/ EuclidProver;
+		bool Lemma
+		(
+			const
+			std::initializer_list<
+			std::string>&
+			InLemmaConstStdStrInitListRef
+		)
+		{
+			const std::vector<std::string>& InLemmaConstStdStrVecRef{ InLemmaConstStdStrInitListRef };
+			return Lemma(InLemmaConstStdStrVecRef);
+		}
 
-	template<>
-	class /*API_EXPORT*/ EuclidProver<BracketType::CurlyBraces>
-	{
-	public:
-		explicit EuclidProver
+		/**
+		Lemmas() : Replace the lemmas: each is { X, Y } (X ==> Y), or { X, { "==>" | "<==" | "<==>" }, Y } (see Lemma).
+		A lemma spares the search a move: a directed one is expanded one way only, where an axiom is expanded both ways.
+		The lemmas are precompiled into the axioms: each axiom side is rewritten through the directed lemmas to a form
+		none of them rewrites further, once, here, rather than by the search; the lemmas follow the axioms in the library,
+		so that theorems are rewritten through them too, each under the next axiom id (see AddAxiom); the lemmas they replace leave
+		their ids empty. Malformed lemmas are skipped, and false returned.
+		*/
+		bool Lemmas
 		(
-			const std::string openBrace = "{",
-			const std::string closeBrace = "}"
-		) noexcept :
-			_openBrace{ openBrace },
-			_openBraceST{ "st" + openBrace },
-			_closeBrace{ closeBrace }
+			const
+			std::vector<
+			std::vector<
+			std::vector<
+			std::string>>>&
+			InLemmasConstStdStrVec
+		)
 		{
+			__stdtracein__("Lemmas");
 
-		}
+			if (th.valid())
+				th.get();
 
-		bool ProofFoundFlag{};
-		bool StatusReadyFlag{};
+			// The lemmas replaced leave their slots empty //
+			for (const std::size_t Lemma_UInt64 : LemmaSlots_UInt64Vec)
+				DeclaredAxiomsStdStrVec[Lemma_UInt64].clear();
+			LemmaSlots_UInt64Vec.clear();
 
-		std::vector<
+			bool bSuccessFlag{ true };
+			for (const std::vector<std::vector<std::string>>& Lemma_StdStrVec : InLemmasConstStdStrVec)
+			{
+				if (Lemma_StdStrVec.size() == 2)
+					bSuccessFlag = AddLemma({ Lemma_StdStrVec[0], { "==>" }, Lemma_StdStrVec[1] }) && bSuccessFlag;
+				else
+					bSuccessFlag = Lemma_StdStrVec.size() == 3 && AddLemma(Lemma_StdStrVec) && bSuccessFlag;
+			}
+			CompileLibrary();
+
+			__stdtraceout__("Lemmas");
+			return bSuccessFlag;
+		}
+
+		bool Lemmas
+		(
+			const
+			std::initializer_list<
 			std::vector<
 			std::vector<
-			std::string>>>
-			ProofStep3DStdStrVec;
+			std::string>>>&
+			InLemmasInitListConstStdStrVec
+		)
+		{
+			const
+				std::vector<
+				std::vector<
+				std::vector<
+				std::string>>>&
+				TempInLemmasConstStdStrVecRef{ InLemmasInitListConstStdStrVec };
 
-		std::vector<
-			std::vector<
-			std::string>>
-			AxiomCommitLogStdStrVecRef;
+			return Lemmas(TempInLemmasConstStdStrVecRef);
+		}
 
-		bool Axiom
+		void Prove
 		(
 			const
 			std::vector<
-			std::string>&
-			InAxiomConstStdStrVecRef
+			std::vector<
+			std::string>>&
+			InProofStdStrVecRef
 		)
 		{
-			return true;
+			__stdtracein__("Prove");
+
+			Reset();
+
+			//ProofStep3DStdStrVec = OutPath3DStdStrVecRef;
+			//TheoremStdStrVec = InProofStdStrVecRef;
+			//AxiomCommitLogStdStrVecRef = OutAxiomCommitLogStdStrVecRef;
+			/*
+			{
+				{"1", "+", "1", "+", "1", "+", "1"}, // (lhs) Prime Composite: 1585615607 //
+				{"4"} // (rhs) Prime Composite: 29 //
+			};
+			*/
+			// Retain a copy of the theorem: the search outlives an initializer_list argument, and Suspend() checkpoints it //
+			TheoremStdStrVec = InProofStdStrVecRef;
+			SearchGuard Running;
+			const std::vector<std::vector<BigInt128_t>>* const EncodedAxiomsPtr = StandingEncoding();
+
+			th = std::async
+			(
+				std::launch::async,
+				__Prove__,
+				std::cref(TheoremStdStrVec),
+				std::cref(AxiomsStdStrVec),
+				std::cref(AxiomCosts_UInt64Vec),
+				std::ref(ProofFoundFlag),
+				std::ref(StatusReadyFlag),
+				std::ref(ProofStep3DStdStrVec),
+				std::ref(AxiomCommitLogStdStrVecRef),
+				std::ref(ReachedTargetIndices),
+				std::ref(RemainingDistance_UInt64),
+				std::ref(SlicedAxioms_UInt64),
+				std::ref(Checkpoint),
+				std::cref(SearchOptions),
+				AxiomSetVersion_UInt64,
+				EncodedAxiomsPtr,
+				&Macros,
+				std::move(Running)
+			);
+			//th.get();
+			//print_path(ProofStep3DStdStrVec);
+
+			__stdtraceout__("Prove");
+
 		}
 
-		bool Axiom
+		void Prove
 		(
 			const
 			std::initializer_list<
-			std::string>&
-			InAxiomInitListConstStdStringRef
+			std::vector<
+			std::string>>&
+			InProofInitListConstStdStrVecRef
 		)
 		{
-			const std::vector<std::string>& InAxiomVecConstStdStringRef{ InAxiomInitListConstStdStringRef };
-			return Axiom(InAxiomVecConstStdStringRef);
+			const
+				std::vector<
+				std::vector<
+				std::string>>&
+				InProofVecConstCharRef{ InProofInitListConstStdStrVecRef };
+
+			Prove(InProofVecConstCharRef);
 		}
 
-		bool Axioms
+		/**
+		Prove() : Goal-set proof - succeeds on reaching any one of InTargetsStdStrVec from InLHSStdStrVec
+		(or the first SearchOptions.MaxProofs_UInt64 of them); ReachedTargetIndices reports which.
+		*/
+		void Prove
 		(
 			const
 			std::vector<
+			std::string>&
+			InLHSStdStrVec,
+
+			const
+			std::span<
+			const
 			std::vector<
-			std::vector<
-			std::string>>>&
-			InAxiomsConstStdStrVec
+			std::string>>
+			InTargetsStdStrVec
 		)
 		{
-			__stdtracein__("Axioms");
+			std::vector<std::vector<std::string>> TempTheoremStdStrVec{ InLHSStdStrVec };
+			TempTheoremStdStrVec.insert(TempTheoremStdStrVec.end(), InTargetsStdStrVec.begin(), InTargetsStdStrVec.end());
+			Prove(TempTheoremStdStrVec);
+		}
+
+		/**
+		Suspend() : Checkpoint the in-flight proof to CheckpointDirectoryStdStr/guid_<hex>.euclid,
+		and return its GUID. Returns 0 when no proof is running (eg. it completed before the request was seen),
+		or when it is searched by any strategy but BestFirst - the one the checkpoint records - which is left running.
+		*/
+		BigInt128_t Suspend()
+		{
+			__stdtracein__("Suspend");
+
+			BigInt128_t GUID_UInt64{};
+
+			// A resumed proof is always searched by BestFirst //
+			if (!th.valid() || ( SearchOptions.SearchStrategy != SearchStrategy_EnumClass::BestFirst && Checkpoint.ResumePathStdStr.empty() ))
+			{
+				__stdtraceout__("Suspend");
+				return GUID_UInt64;
+			}
+
+			std::random_device rd;
+			for (int i = 0; i < 4; ++i)
+			{
+				GUID_UInt64 <<= 32;
+				GUID_UInt64 |= static_cast<std::uint32_t>(rd());
+			}
+			GUID_UInt64 |= 1; // Reserve 0 for "Not Suspended" //
+
+			Checkpoint.SuspendPathStdStr = CheckpointPath(GUID_UInt64);
+			Checkpoint.SuspendRequestFlag = true;
+
+			th.get();
+
+			Checkpoint.SuspendRequestFlag = false;
+
+			if (!Checkpoint.SuspendedFlag)
+				GUID_UInt64 = 0;
+
+			__stdtraceout__("Suspend");
+			return GUID_UInt64;
+		}
+
+		/**
+		Resume() : Continue a proof from its Suspend() checkpoint; the theorem and axioms are restored from the blob,
+		so a proof can also be resumed by a new EuclidProver instance (or process). The checkpoint's symbol table replaces
+		the process-wide one, so Resume() fails while any other prover's search (Prove, ProveBatch, ...) is running.
+		*/
+		bool Resume(const BigInt128_t& InGUID_UInt64)
+		{
+			__stdtracein__("Resume");
+
+			// The symbol table is replaced below; wait out any in-flight Prove() //
+			if (th.valid())
+				th.get();
+
+			SearchGuard Running;
+
+			const std::string Path_StdStr = CheckpointPath(InGUID_UInt64);
+
+			bool bSuccessFlag{};
 
-			AxiomsStdStrVec = InAxiomsConstStdStrVec;
-			/*
 			{
+				const MappedFile Blob(Path_StdStr);
+				CheckpointReader Reader;
+
+				std::vector<std::vector<std::string>> TempTheoremStdStrVec;
+				std::uint64_t I = OpenCheckpointSection(Blob, CheckpointSection_EnumClass::Theorem, Reader);
+				for (std::uint64_t i = 0; i < I && !Reader.OverrunFlag; ++i)
+					TempTheoremStdStrVec.emplace_back(Reader.ReadStdStrVec());
+				bSuccessFlag = !Reader.OverrunFlag;
+
+				std::vector<std::vector<std::vector<std::string>>> TempAxiomsStdStrVec;
+				I = OpenCheckpointSection(Blob, CheckpointSection_EnumClass::Axioms, Reader);
+				for (std::uint64_t i = 0; i < I && !Reader.OverrunFlag; ++i)
 				{
-					{"1", "+", "1"}, // (lhs) Prime Composite: 8303 //
-					{"2"} // (rhs) Prime Composite: 31
-				},
+					std::vector<std::vector<std::string>> Subnet_StdStrVec;
+					const std::uint64_t J = Reader.ReadUInt64();
+					for (std::uint64_t j = 0; j < J && !Reader.OverrunFlag; ++j)
+						Subnet_StdStrVec.emplace_back(Reader.ReadStdStrVec());
+					TempAxiomsStdStrVec.emplace_back(std::move(Subnet_StdStrVec));
+				}
+				bSuccessFlag = bSuccessFlag && !Reader.OverrunFlag;
 
+				// The checkpoint's symbol table comes first, so that the library compiles onto the suspended composites //
+				bSuccessFlag = bSuccessFlag && RestoreSymbolTable(Blob, Running);
+
+				if (bSuccessFlag)
 				{
-					{"2", "+", "2"}, // (lhs) Prime Composite: 22103 //
-					{"4"} // (rhs) Prime Composite: 29 //
+					TheoremStdStrVec = std::move(TempTheoremStdStrVec);
+					// The library was compiled when checkpointed: it is declared as it was searched, its directed rules as its lemmas //
+					DeclaredAxiomsStdStrVec = std::move(TempAxiomsStdStrVec);
+					AxiomOnlineFlagVec.assign(DeclaredAxiomsStdStrVec.size(), true);
+					LemmaSlots_UInt64Vec.clear();
+					for (std::size_t a = 0; a < DeclaredAxiomsStdStrVec.size(); ++a)
+						if (DirectedAxiom(DeclaredAxiomsStdStrVec[a]))
+							LemmaSlots_UInt64Vec.emplace_back(a);
+					AxiomCosts_UInt64Vec.clear();
+					CompileLibrary();
 				}
-			};
-			*/
+			}
 
-			__stdtraceout__("Axioms");
-			return true;
+			if (bSuccessFlag)
+			{
+				Reset();
+
+				Checkpoint.ResumePathStdStr = Path_StdStr;
+
+				th = std::async
+				(
+					std::launch::async,
+					__Prove__,
+					std::cref(TheoremStdStrVec),
+					std::cref(AxiomsStdStrVec),
+					std::cref(AxiomCosts_UInt64Vec),
+					std::ref(ProofFoundFlag),
+					std::ref(StatusReadyFlag),
+					std::ref(ProofStep3DStdStrVec),
+					std::ref(AxiomCommitLogStdStrVecRef),
+					std::ref(ReachedTargetIndices),
+					std::ref(RemainingDistance_UInt64),
+					std::ref(SlicedAxioms_UInt64),
+					std::ref(Checkpoint),
+					std::cref(SearchOptions),
+					AxiomSetVersion_UInt64,
+					nullptr,
+					&Macros,
+					std::move(Running)
+				);
+			}
+
+			__stdtraceout__("Resume");
+			return bSuccessFlag;
 		}
 
-		bool Axioms
+		/**
+		ProveBatch() : Prove many theorems against the current axioms on a pool of InWorkers_UInt64 threads (0: one per core).
+		The library's standing encoding is shared read-only by every worker; results are returned in theorem order.
+		Blocks until every theorem has been attempted.
+		*/
+		std::vector<ProofResult_Struct> ProveBatch
 		(
 			const
-			std::initializer_list<
+			std::span<
+			const
 			std::vector<
 			std::vector<
-			std::string>>>& InAxiomInitListConstStdStringRef
-		)
-		{
-			const
-				std::vector<
-				std::vector<
-				std::vector<
-				std::string>>>&
-				TempInAxiomsConstStdStrVecRef{ InAxiomInitListConstStdStringRef };
-
-			return Axioms(TempInAxiomsConstStdStrVecRef);
-		}
+			std::string>>>
+			InTheoremsStdStrVec,
 
-		bool Lemma
-		(
 			const
-			std::vector<
-			std::string>&
-			InLemmaConstStdStringVecRef
+			std::size_t
+			InWorkers_UInt64 = 0
 		)
 		{
-			return true;
+			__stdtracein__("ProveBatch");
+
+			// The symbol table is extended below; wait out any in-flight Prove() //
+			if (th.valid())
+				th.get();
+
+			const SearchGuard Running;
+
+			const std::vector<std::vector<BigInt128_t>>* const EncodedAxiomsPtr = StandingEncoding();
+			for (const std::vector<std::vector<std::string>>& Theorem_StdStrVec : InTheoremsStdStrVec)
+				RegisterSymbols(Theorem_StdStrVec);
+
+			std::vector<ProofResult_Struct> Results(InTheoremsStdStrVec.size());
+
+			const std::size_t Workers_UInt64 = std::min<std::size_t>
+			(
+				InTheoremsStdStrVec.size(),
+				InWorkers_UInt64 ? InWorkers_UInt64 : std::max(1u, std::thread::hardware_concurrency())
+			);
+
+			// The workers share one frontier RAM budget //
+			ProofSearchOptions_Struct Options{ SearchOptions };
+			if (Options.FrontierMemoryCeiling_UInt64 && Workers_UInt64)
+				Options.FrontierMemoryCeiling_UInt64 = std::max<std::size_t>(1, Options.FrontierMemoryCeiling_UInt64 / Workers_UInt64);
+
+			std::atomic<std::size_t> NextTheorem_UInt64{};
+			std::vector<std::future<void>> Workers;
+			for (std::size_t w = 0; w < Workers_UInt64; ++w)
+			{
+				Workers.emplace_back
+				(
+					std::async
+					(
+						std::launch::async,
+						[&]( ) -> void
+						{
+							for (std::size_t i = NextTheorem_UInt64++; i < InTheoremsStdStrVec.size(); i = NextTheorem_UInt64++)
+							{
+								ProofCheckpoint_Struct TempCheckpoint{};
+								bool TempStatusReadyFlag{};
+								__Prove__
+								(
+									InTheoremsStdStrVec[i],
+									AxiomsStdStrVec,
+									AxiomCosts_UInt64Vec,
+									Results[i].ProofFoundFlag,
+									TempStatusReadyFlag,
+									Results[i].ProofStep3DStdStrVec,
+									Results[i].AxiomCommitLogStdStrVec,
+									Results[i].ReachedTargetIndices,
+									Results[i].RemainingDistance_UInt64,
+									Results[i].SlicedAxioms_UInt64,
+									TempCheckpoint,
+									Options,
+									AxiomSetVersion_UInt64,
+									EncodedAxiomsPtr,
+									&Macros,
+									SearchGuard{}
+								);
+							}
+						}
+					)
+				);
+			}
+
+			for (std::future<void>& Worker : Workers)
+				Worker.get();
+
+			__stdtraceout__("ProveBatch");
+			return Results;
 		}
 
-		bool Lemma
+		/**
+		LearnMacros() : Mine the commit logs of solved proofs for the axiom chains they repeat, and add the most useful
+		(at most InMaxMacros_UInt64) to Macros as macro-axioms, which BestFirst applies in one move (see MacroOperators).
+		The macros belong to the current axioms: Axioms() drops them, and with a SearchOptions.ProofStoreDirectoryStdStr
+		they are saved beside the ProofStore, to be reloaded by Axioms() whenever the same library is loaded again.
+		Returns the number of macros added.
+		usage: ep.LearnMacros(ep.ProveBatch(Theorems));
+		*/
+		std::size_t LearnMacros
 		(
 			const
-			std::initializer_list<
-			std::string>&
-			InLemmaConstStdStrInitListRef
+			std::span<
+			const
+			ProofResult_Struct>
+			InSolvedRef,
+
+			const std::size_t InMinSupport_UInt64 = 2,
+			const std::size_t InMaxLength_UInt64 = 4,
+			const std::size_t InMaxMacros_UInt64 = 16
 		)
 		{
-			const std::vector<std::string>& InLemmaConstStdStrVecRef{ InLemmaConstStdStrInitListRef };
-			return Lemma(InLemmaConstStdStrVecRef);
+			__stdtracein__("LearnMacros");
+
+			// The symbol table is extended below; wait out any in-flight Prove() //
+			if (th.valid())
+				th.get();
+
+			std::vector<std::vector<std::string>> CommitLogs_StdStrVec;
+			for (const ProofResult_Struct& Result : InSolvedRef)
+				if (Result.ProofFoundFlag && !Result.AxiomCommitLogStdStrVec.empty())
+					CommitLogs_StdStrVec.emplace_back(Result.AxiomCommitLogStdStrVec.back());
+
+			const std::size_t Learned_UInt64 = Macros.Learn(CommitLogs_StdStrVec, *StandingEncoding(), InMinSupport_UInt64, InMaxLength_UInt64, InMaxMacros_UInt64);
+			if (!SearchOptions.ProofStoreDirectoryStdStr.empty())
+				Macros.Save(MacrosPath());
+
+			__stdtraceout__("LearnMacros");
+			return Learned_UInt64;
 		}
 
-		bool Lemmas
+		/**
+		ProveShared() : Prove many theorems against the current axioms, grouping those that share an LHS
+		into one combined exploration (see __ProveShared__), instead of re-expanding the same states per theorem.
+		Results are returned in theorem order. Blocks until every group has been explored.
+		*/
+		std::vector<ProofResult_Struct> ProveShared
 		(
+			const
+			std::span<
 			const
 			std::vector<
 			std::vector<
-			std::vector<
-			std::string>>>&
-			InLemmasConstStdStrVec
+			std::string>>>
+			InTheoremsStdStrVec
 		)
 		{
-			return true;
+			__stdtracein__("ProveShared");
+
+			// The symbol table is extended below; wait out any in-flight Prove() //
+			if (th.valid())
+				th.get();
+
+			const SearchGuard Running;
+
+			// One time budget for the whole call, over every group //
+			DeadlineWatchdog Watchdog{ SearchOptions.TimeBudgetMilliseconds_UInt64 };
+
+			for (const std::vector<std::vector<std::string>>& Axiom_StdStrVec : AxiomsStdStrVec)
+				RegisterSymbols(Axiom_StdStrVec);
+			for (const std::vector<std::vector<std::string>>& Theorem_StdStrVec : InTheoremsStdStrVec)
+				RegisterSymbols(Theorem_StdStrVec);
+
+			std::unordered_map<std::string, std::vector<std::size_t>> Groups;
+			for (std::size_t i = 0; i < InTheoremsStdStrVec.size(); ++i)
+				Groups[TheoremTokenKey({ InTheoremsStdStrVec[i].front() })].emplace_back(i);
+
+			std::vector<ProofResult_Struct> Results(InTheoremsStdStrVec.size());
+			for (const auto& [Key_StdStr, Indices] : Groups)
+			{
+				std::vector<std::vector<std::vector<std::string>>> Group_StdStrVec;
+				for (const std::size_t i : Indices)
+					Group_StdStrVec.emplace_back(InTheoremsStdStrVec[i]);
+
+				std::vector<ProofResult_Struct> GroupResults;
+				__ProveShared__(Group_StdStrVec, AxiomsStdStrVec, GroupResults, SearchOptions, Watchdog.AbortFlag);
+				for (std::size_t j = 0; j < Indices.size(); ++j)
+					Results[Indices[j]] = std::move(GroupResults[j]);
+			}
+
+			__stdtraceout__("ProveShared");
+			return Results;
 		}
 
-		bool Lemmas
+		/**
+		ReachableWithin() : Every expression reachable from InExpressionStdStrVec within InSteps_UInt64 rewrites of the current axioms,
+		each listed once, in order of rewrite distance (InExpressionStdStrVec first). Enumerated by the level-synchronous
+		breadth-first engine, on SearchOptions.SearchWorkers_UInt64 threads and up to SearchOptions.StateLimit_UInt64 states.
+		usage: for (const std::vector<std::string>& Move_StdStrVec : ep.ReachableWithin({ "1", "+", "1", "+", "1" }, 2)) { ... }
+		*/
+		std::vector<std::vector<std::string>> ReachableWithin
 		(
 			const
-			std::initializer_list<
 			std::vector<
-			std::vector<
-			std::string>>>&
-			InLemmasInitListConstStdStrVec
+			std::string>&
+			InExpressionStdStrVec,
+
+			const
+			std::size_t
+			InSteps_UInt64
 		)
 		{
-			const
-				std::vector<
-				std::vector<
-				std::vector<
-				std::string>>>&
-				TempInLemmasConstStdStrVecRef{ InLemmasInitListConstStdStrVec };
+			__stdtracein__("ReachableWithin");
 
-			return Lemmas(TempInLemmasConstStdStrVecRef);
+			// The symbol table is extended below; wait out any in-flight Prove() //
+			if (th.valid())
+				th.get();
+
+			const SearchGuard Running;
+
+			DeadlineWatchdog Watchdog{ SearchOptions.TimeBudgetMilliseconds_UInt64 };
+
+			const std::vector<std::vector<BigInt128_t>>& WrittenAxioms_UInt64Vec = *StandingEncoding();
+			RegisterSymbols({ InExpressionStdStrVec });
+
+			ProofSearchOptions_Struct Options{ SearchOptions };
+			Options.MaxDepth_UInt64 = InSteps_UInt64;
+
+			// The expression is an LHS with an empty RHS (composite 1), which no axiom rewrites //
+			const std::vector<BoundedSearchNode_Struct> Roots{ { { EncodeSubnet(InExpressionStdStrVec), 1, 0, 0 }, { InExpressionStdStrVec, {} } } };
+			std::vector<BoundedSearchNode_Struct> Reached;
+			__ProveLevelSynchronous__(Roots, WrittenAxioms_UInt64Vec, AxiomsStdStrVec, nullptr, Options, Watchdog.AbortFlag, &Reached);
+
+			std::vector<std::vector<std::string>> Expressions_StdStrVec;
+			for (BoundedSearchNode_Struct& Node : Reached)
+				Expressions_StdStrVec.emplace_back(std::move(Node.TheoremStdStrVec[0]));
+
+			__stdtraceout__("ReachableWithin");
+			return Expressions_StdStrVec;
 		}
 
-		void Prove
+		/**
+		ProveKBest() : Stream the InK_UInt64 cheapest distinct proofs of a theorem (of a goal set: of any target), cheapest first,
+		to InOnProofRef, which returns true to stop early. Costs are the axiom costs (see Axioms(); 1 each by default), so
+		with unit costs these are the k shortest proofs. The search graph is explored once and the proofs extracted from it
+		(see __ProveKBest__). Blocks until done; returns the number of proofs delivered.
+		usage: ep.ProveKBest({ {"1", "+", "1", "+", "1", "+", "1"}, {"4"} }, 3, [](const ProofResult_Struct& InProofRef) { ...; return false; });
+		*/
+		std::size_t ProveKBest
 		(
 			const
 			std::vector<
 			std::vector<
 			std::string>>&
-			InProofStdStrVecRef
+			InTheoremStdStrVec,
+
+			const
+			std::size_t
+			InK_UInt64,
+
+			const
+			std::function<
+			bool(const ProofResult_Struct&)>&
+			InOnProofRef
 		)
 		{
-			__stdtracein__("Prove");
+			__stdtracein__("ProveKBest");
 
-			Reset();
+			// The symbol table is extended below; wait out any in-flight Prove() //
+			if (th.valid())
+				th.get();
 
-			//ProofStep3DStdStrVec = OutPath3DStdStrVecRef;
-			//TheoremStdStrVec = InProofStdStrVecRef;
-			//AxiomCommitLogStdStrVecRef = OutAxiomCommitLogStdStrVecRef;
-			/*
+			const SearchGuard Running;
+
+			DeadlineWatchdog Watchdog{ SearchOptions.TimeBudgetMilliseconds_UInt64 };
+
+			const std::vector<std::vector<BigInt128_t>>& WrittenAxioms_UInt64Vec = *StandingEncoding();
+			RegisterSymbols(InTheoremStdStrVec);
+
+			// Targets outside the axioms' difference lattice have no proofs to enumerate //
+			const std::shared_ptr<const AxiomLattice> Lattice = SearchOptions.bLatticeCheckFlag ? AxiomLatticeOf(AxiomSetVersion_UInt64, AxiomsStdStrVec) : nullptr;
+
+			std::vector<std::vector<std::vector<std::string>>> TargetTheoremsStdStrVec;
+			std::vector<BoundedSearchNode_Struct> Roots;
+			for (std::size_t k = 1; k < InTheoremStdStrVec.size(); ++k)
 			{
-				{"1", "+", "1", "+", "1", "+", "1"}, // (lhs) Prime Composite: 1585615607 //
-				{"4"} // (rhs) Prime Composite: 29 //
-			};
-			*/
-			/*th = */std::async
+				TargetTheoremsStdStrVec.push_back({ InTheoremStdStrVec.front(), InTheoremStdStrVec[k] });
+				if (Lattice && !Lattice->Contains(InTheoremStdStrVec.front(), InTheoremStdStrVec[k]))
+					continue;
+				Roots.push_back({ { EncodeSubnet(InTheoremStdStrVec.front()), EncodeSubnet(InTheoremStdStrVec[k]), k - 1, 0 }, TargetTheoremsStdStrVec.back() });
+			}
+
+			const std::size_t Delivered_UInt64 = __ProveKBest__
 			(
-				std::launch::async,
-				__Prove__,
-				std::cref(InProofStdStrVecRef),
-				std::cref(AxiomsStdStrVec),
-				std::ref(ProofFoundFlag),
-				std::ref(StatusReadyFlag),
-				std::ref(ProofStep3DStdStrVec),
-				std::ref(AxiomCommitLogStdStrVecRef)
+				Roots,
+				WrittenAxioms_UInt64Vec,
+				AxiomsStdStrVec,
+				AxiomCosts_UInt64Vec,
+				InK_UInt64,
+				[&](const std::vector<BigInt128_t>& InTheoremRef, const std::uint64_t InCost_UInt64) -> bool
+				{
+					ProofResult_Struct Result;
+					const std::size_t Target_UInt64 = static_cast<std::size_t>(InTheoremRef[2]);
+					Result.ProofFoundFlag = ProofVerified(InTheoremRef, TargetTheoremsStdStrVec[Target_UInt64], AxiomsStdStrVec, Result.ProofStep3DStdStrVec, Result.AxiomCommitLogStdStrVec);
+					Result.ReachedTargetIndices.emplace_back(Target_UInt64);
+					Result.ProofCost_UInt64 = InCost_UInt64;
+					return InOnProofRef(Result);
+				},
+				SearchOptions,
+				Watchdog.AbortFlag
 			);
-			//th.get();
-			//print_path(ProofStep3DStdStrVec);
-
-			__stdtraceout__("Prove");
 
+			__stdtraceout__("ProveKBest");
+			return Delivered_UInt64;
 		}
 
-		void Prove
-		(
-			const
-			std::initializer_list<
-			std::vector<
-			std::string>>&
-			InProofInitListConstStdStrVecRef
-		)
-		{
-			const
-				std::vector<
-				std::vector<
-				std::string>>&
-				InProofVecConstCharRef{ InProofInitListConstStdStrVecRef };
+		// Frontier RAM ceiling, spill directory, ... for every subsequent Prove() //
+		ProofSearchOptions_Struct SearchOptions{};
 
-			Prove(InProofVecConstCharRef);
-		}
+		// Suspend() checkpoints are written here; defaults to the working directory //
+		std::string CheckpointDirectoryStdStr{ "." };
 
 		bool StatusReady()
 		{
@@ -1465,23 +8258,226 @@ namespace Euclid_Prover
 		//std::thread th;
 		std::future<int> th;
 
+		// The search library, one entry per slot: the slot's axiom compiled through the lemmas, or {} once removed or offline //
 		std::vector<
 			std::vector<
 			std::vector<
 			std::string>>>
 			AxiomsStdStrVec{};
 
+		// The library as declared, one slot per axiom and lemma, indexed by its id: Axioms() fills slots 0..n-1, its lemmas follow,
+		// and AddAxiom() and Lemma() append; a removed slot is left empty, never reused, so every other id stays put //
+		std::vector<
+			std::vector<
+			std::vector<
+			std::string>>>
+			DeclaredAxiomsStdStrVec{};
+
+		// The lemma index: the ascending ids of the slots holding lemmas, directed rules { From, To, { "==>" } } or two-way { LHS, RHS } //
+		std::vector<std::size_t> LemmaSlots_UInt64Vec{};
+
+		// Slots online, as SetAxiomOnline() leaves them //
+		std::vector<bool> AxiomOnlineFlagVec{};
+
+		// AxiomsStdStrVec encoded as written, row for row, against the symbol table of generation EncodedGeneration_UInt64 //
+		std::vector<std::vector<BigInt128_t>> EncodedAxioms_UInt64Vec{};
+		std::uint64_t EncodedGeneration_UInt64{};
+
+		// Each slot's share of AxiomSetVersion_UInt64 (see RehashSlot) //
+		std::vector<std::uint64_t> SlotVersion_UInt64Vec{};
+
+		// Per-axiom costs for the MinimumCost strategy (empty: every axiom costs 1) //
+		std::vector<std::uint64_t> AxiomCosts_UInt64Vec{};
+
+		std::uint64_t AxiomSetVersion_UInt64{ AxiomSetVersion({}) };
+
 		std::vector<
 			std::vector<
 			std::string>>
 			TheoremStdStrVec{};
 
+		ProofCheckpoint_Struct Checkpoint{};
+
+		std::string CheckpointPath(const BigInt128_t& InGUID_UInt64) const
+		{
+			return ( std::filesystem::path(CheckpointDirectoryStdStr) / ( "guid_" + InGUID_UInt64.str(0, std::ios_base::hex) + ".euclid" ) ).string();
+		}
+
+		// Macros are filed beside the ProofStore under the library's tokens (not its costs, which no macro depends on) //
+		std::string MacrosPath() const
+		{
+			return ( std::filesystem::path(SearchOptions.ProofStoreDirectoryStdStr) / ( "macros_" + std::to_string(AxiomSetVersion(AxiomsStdStrVec)) + ".txt" ) ).string();
+		}
+
+		void LoadMacros()
+		{
+			Macros = MacroOperators{};
+			if (!SearchOptions.ProofStoreDirectoryStdStr.empty())
+				Macros.Load(MacrosPath());
+		}
+
+		// An id naming a slot still in the library //
+		bool AxiomSlot(const std::size_t InAxiomId_UInt64) const
+		{
+			return InAxiomId_UInt64 < DeclaredAxiomsStdStrVec.size() && !DeclaredAxiomsStdStrVec[InAxiomId_UInt64].empty();
+		}
+
+		bool LemmaSlot(const std::size_t InAxiomId_UInt64) const
+		{
+			return std::binary_search(LemmaSlots_UInt64Vec.begin(), LemmaSlots_UInt64Vec.end(), InAxiomId_UInt64);
+		}
+
+		// Append a slot, online, under the next id; its search entry is left to CompileLibrary() or UpdateSlot() //
+		std::size_t AppendSlot(const std::vector<std::vector<std::string>>& InAxiomStdStrVec)
+		{
+			DeclaredAxiomsStdStrVec.emplace_back(InAxiomStdStrVec);
+			AxiomOnlineFlagVec.emplace_back(true);
+			return DeclaredAxiomsStdStrVec.size() - 1;
+		}
+
+		// Index { X, { arrow }, Y } as a directed rule, or as a two-way lemma for "<==>" //
+		bool AddLemma(const std::vector<std::vector<std::string>>& InLemmaStdStrVec)
+		{
+			const std::vector<std::string>& Arrow_StdStrVec = InLemmaStdStrVec[1];
+			if (Arrow_StdStrVec.size() != 1 || InLemmaStdStrVec[0].empty() || InLemmaStdStrVec[2].empty())
+				return false;
+
+			if (Arrow_StdStrVec[0] == "==>")
+				LemmaSlots_UInt64Vec.emplace_back(AppendSlot({ InLemmaStdStrVec[0], InLemmaStdStrVec[2], { "==>" } }));
+			else if (Arrow_StdStrVec[0] == "<==")
+				LemmaSlots_UInt64Vec.emplace_back(AppendSlot({ InLemmaStdStrVec[2], InLemmaStdStrVec[0], { "==>" } }));
+			else if (Arrow_StdStrVec[0] == "<==>")
+				LemmaSlots_UInt64Vec.emplace_back(AppendSlot({ InLemmaStdStrVec[0], InLemmaStdStrVec[2] }));
+			else
+				return false;
+			return true;
+		}
+
+		/**
+		 * LemmaNormalForm() : Rewrite an expression by the directed lemmas online until none applies. Fails where two lemmas both
+		 * apply, since which one runs decides what the expression can still reach, or past 1 << 10 rewrites (a cycle of lemmas).
+		*/
+		bool LemmaNormalForm(std::vector<std::string>& InOutExpressionStdStrVecRef) const
+		{
+			for (std::size_t Rewrites_UInt64 = 0; Rewrites_UInt64 < ( std::size_t{ 1 } << 10 ); ++Rewrites_UInt64)
+			{
+				const std::vector<std::vector<std::string>>* LemmaPtr{};
+				for (const std::size_t Lemma_UInt64 : LemmaSlots_UInt64Vec)
+				{
+					const std::vector<std::vector<std::string>>& Lemma_StdStrVec = DeclaredAxiomsStdStrVec[Lemma_UInt64];
+					if (!AxiomOnlineFlagVec[Lemma_UInt64] || !DirectedAxiom(Lemma_StdStrVec) ||
+						std::search(InOutExpressionStdStrVecRef.begin(), InOutExpressionStdStrVecRef.end(), Lemma_StdStrVec[0].begin(), Lemma_StdStrVec[0].end()) == InOutExpressionStdStrVecRef.end())
+						continue;
+					if (LemmaPtr)
+						return false;
+					LemmaPtr = &Lemma_StdStrVec;
+				}
+				if (!LemmaPtr)
+					return true;
+				Rewrite(InOutExpressionStdStrVecRef, ( *LemmaPtr )[0], ( *LemmaPtr )[1]);
+			}
+			return false;
+		}
+
+		// A slot's search entry: {} once removed or offline, a lemma as declared, an axiom with both sides precompiled through the lemmas //
+		std::vector<std::vector<std::string>> SearchEntry(const std::size_t InAxiomId_UInt64) const
+		{
+			const std::vector<std::vector<std::string>>& Declared_StdStrVec = DeclaredAxiomsStdStrVec[InAxiomId_UInt64];
+			if (!AxiomOnlineFlagVec[InAxiomId_UInt64] || Declared_StdStrVec.size() < 2)
+				return {};
+			if (LemmaSlot(InAxiomId_UInt64) || DirectedAxiom(Declared_StdStrVec))
+				return Declared_StdStrVec;
+
+			std::vector<std::vector<std::string>> Axiom_StdStrVec{ Declared_StdStrVec };
+
+			// An axiom the lemmas collapse to X = X would prove nothing; keep it as declared //
+			if (!LemmaNormalForm(Axiom_StdStrVec[0]) || !LemmaNormalForm(Axiom_StdStrVec[1]) || Axiom_StdStrVec[0] == Axiom_StdStrVec[1])
+				return Declared_StdStrVec;
+			return Axiom_StdStrVec;
+		}
+
+		// The search library, its encoding, call graph and version, rebuilt from the slots: for a new library, or a change to its lemmas //
+		void CompileLibrary()
+		{
+			AxiomsStdStrVec.resize(DeclaredAxiomsStdStrVec.size());
+			for (std::size_t a = 0; a < DeclaredAxiomsStdStrVec.size(); ++a)
+				AxiomsStdStrVec[a] = SearchEntry(a);
+
+			EncodedAxioms_UInt64Vec = EncodeAxioms(AxiomsStdStrVec, false);
+			EncodedGeneration_UInt64 = SymbolTableGeneration_UInt64;
+			RewriteGraph = AxiomRewriteGraph(AxiomsStdStrVec);
+			RehashLibrary();
+			LoadMacros();
+		}
+
+		// ...and one slot of it, in the time its own entry takes, and its neighbours in the call graph //
+		void UpdateSlot(const std::size_t InAxiomId_UInt64)
+		{
+			StandingEncoding();
+			AxiomsStdStrVec.resize(DeclaredAxiomsStdStrVec.size());
+			EncodedAxioms_UInt64Vec.resize(DeclaredAxiomsStdStrVec.size());
+			SlotVersion_UInt64Vec.resize(DeclaredAxiomsStdStrVec.size());
+
+			AxiomsStdStrVec[InAxiomId_UInt64] = SearchEntry(InAxiomId_UInt64);
+			std::vector<BigInt128_t> Encoded_UInt64Vec = EncodeAxioms({ AxiomsStdStrVec[InAxiomId_UInt64] }, false).front();
+			Encoded_UInt64Vec[std::min<std::size_t>(Encoded_UInt64Vec.size() - 1, 2)] = InAxiomId_UInt64 + 1; // its guid //
+			EncodedAxioms_UInt64Vec[InAxiomId_UInt64] = std::move(Encoded_UInt64Vec);
+			RewriteGraph.Insert(InAxiomId_UInt64, AxiomsStdStrVec[InAxiomId_UInt64]);
+			RehashSlot(InAxiomId_UInt64);
+		}
+
+		// The standing encoding of AxiomsStdStrVec, which __Prove__ slices rather than re-encodes; re-encoded only after a Resume
+		// has replaced the symbol table //
+		const std::vector<std::vector<BigInt128_t>>* StandingEncoding()
+		{
+			if (EncodedGeneration_UInt64 != SymbolTableGeneration_UInt64 || EncodedAxioms_UInt64Vec.size() != AxiomsStdStrVec.size())
+			{
+				EncodedAxioms_UInt64Vec = EncodeAxioms(AxiomsStdStrVec, false);
+				EncodedGeneration_UInt64 = SymbolTableGeneration_UInt64;
+			}
+			return &EncodedAxioms_UInt64Vec;
+		}
+
+		// The library version is the XOR of its slots' hashes (id, cost and search entry): it follows any one edit in O(1), and
+		// depends on the library alone, not the edits that built it, so an axiom taken offline and back finds its proofs still cached //
+		void RehashSlot(const std::size_t InAxiomId_UInt64)
+		{
+			const std::vector<std::vector<std::vector<std::string>>> Slot_StdStrVec
+			{
+				{ { std::to_string(InAxiomId_UInt64), std::to_string(AxiomCost(AxiomCosts_UInt64Vec, InAxiomId_UInt64)) } },
+				AxiomsStdStrVec[InAxiomId_UInt64]
+			};
+			AxiomSetVersion_UInt64 ^= SlotVersion_UInt64Vec[InAxiomId_UInt64];
+			SlotVersion_UInt64Vec[InAxiomId_UInt64] = AxiomSetVersion(Slot_StdStrVec);
+			AxiomSetVersion_UInt64 ^= SlotVersion_UInt64Vec[InAxiomId_UInt64];
+		}
+
+		void RehashLibrary()
+		{
+			AxiomSetVersion_UInt64 = 0;
+			SlotVersion_UInt64Vec.assign(AxiomsStdStrVec.size(), 0);
+			for (std::size_t a = 0; a < AxiomsStdStrVec.size(); ++a)
+				RehashSlot(a);
+		}
+
 		void Reset()
 		{
 			__stdtracein__("Reset");
 
+			if (th.valid())
+				th.get();
+
 			StatusReadyFlag = false;
 			ProofFoundFlag = false;
+			ReachedTargetIndices.clear();
+			RemainingDistance_UInt64 = 0;
+			SlicedAxioms_UInt64 = 0;
+			ProofStep3DStdStrVec.clear();
+			AxiomCommitLogStdStrVecRef.clear();
+
+			Checkpoint.SuspendRequestFlag = false;
+			Checkpoint.SuspendedFlag = false;
+			Checkpoint.ResumePathStdStr.clear();
 
 			__stdtraceout__("Reset");
 		};
@@ -395,7 +395,7 @@ int main()
         ProofStep4DStdStrVec;
         Euclid.PrintPath(AxiomCommitLogStdStrVec);
     } else if (ProofStep4DStdStrVec.size()) {
-        std::cout << "Partial Proof Found." << std::endl;
+        std::cout << "Partial Proof Found. (" << Euclid.RemainingDistance_UInt64 << " tokens from a proof)" << std::endl;
         ProofStep4DStdStrVec;
         Euclid.PrintPath(AxiomCommitLogStdStrVec);
     } else {